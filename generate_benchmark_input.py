@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+"""
+Generator of synthetic inputs for the performance benchmarks (run_benchmark_*.sh)
+
+Usage:
+    python3 generate_benchmark_input.py <num_demands> <output_file> [demands_per_second] [space] [seed]
+
+Configuration:
+- Fixed: eta=4, gamma=50.0, delta=30.0, alpha=400.0, beta=600.0, lambda=0.5
+- Demands arrive at a constant rate (demands_per_second, default 10)
+- Origins and destinations uniform in a space x space square (default 10000)
+"""
+
+import random
+import sys
+
+FIXED_ETA = 4
+FIXED_GAMMA = 50.0
+FIXED_DELTA = 30.0
+FIXED_ALPHA = 400.0
+FIXED_BETA = 600.0
+FIXED_LAMBDA = 0.5
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        sys.exit(1)
+
+    num_demands = int(sys.argv[1])
+    output_file = sys.argv[2]
+    rate = float(sys.argv[3]) if len(sys.argv) > 3 else 10.0
+    space = float(sys.argv[4]) if len(sys.argv) > 4 else 10000.0
+    random.seed(int(sys.argv[5]) if len(sys.argv) > 5 else 42)
+
+    with open(output_file, 'w') as f:
+        f.write(f"{FIXED_ETA}\n{FIXED_GAMMA}\n{FIXED_DELTA}\n{FIXED_ALPHA}\n")
+        f.write(f"{FIXED_BETA}\n{FIXED_LAMBDA}\n{num_demands}\n")
+
+        lines = []
+        for demand_id in range(num_demands):
+            time = demand_id / rate
+            lines.append(f"{demand_id} {time:.2f} {random.uniform(0, space):.5f} {random.uniform(0, space):.5f} "
+                         f"{random.uniform(0, space):.5f} {random.uniform(0, space):.5f}\n")
+            if len(lines) >= 100000:
+                f.writelines(lines)
+                lines = []
+        f.writelines(lines)
+
+    print(f"Generated {num_demands} demands in: {output_file}")
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,55 @@
+#ifndef AGRUPAMENTO_HPP
+#define AGRUPAMENTO_HPP
+
+#include "Arena.hpp"
+#include "AvaliadorCorrida.hpp"
+#include "Corrida.hpp"
+#include "Demanda.hpp"
+#include "GradeEspacial.hpp"
+#include "GrafoCompatibilidade.hpp"
+#include "VerificadorCompatibilidade.hpp"
+
+// Fase 1: cada demanda ainda não agrupada vira base de uma corrida com as
+// seguintes da sua janela temporal que passam nos critérios de distância e
+// de eficiência. Usada pela execução em lote (em paralelo, por lotes), pelo
+// modo online (base a base) e pela varredura
+
+struct ParametrosFase1 {
+    int eta;
+    double gama, delta, alfa, beta, lambda;
+    bool avaliacao_reconstrucao;
+    const GradeEspacial* grade;     // nullptr: varredura linear da janela
+    const GrafoCompatibilidade* grafo; // Se presente, substitui grade e verificador
+};
+
+// Estado de trabalho de uma thread da fase 1
+struct TrabalhadorFase1 {
+    Arena* arena;                   // Recebe as corridas finais
+    Arena* rascunho;                // Corridas candidatas (modo reconstrução)
+    AvaliadorCorrida avaliador;
+    VerificadorCompatibilidade verificador;
+    int* candidatas;                // Resultado das consultas à grade
+    int capacidade_candidatas;
+    
+    // Construtor
+    TrabalhadorFase1(DemandaStore* demandas, const ParametrosFase1& parametros, ConjuntoInstrucoes isa,
+                     Arena* arena, Arena* rascunho);
+    
+    // Destrutor
+    ~TrabalhadorFase1();
+    
+    // Operações principais
+    int* reservarCandidatas(int quantidade);
+    
+private:
+    TrabalhadorFase1(const TrabalhadorFase1&);
+    TrabalhadorFase1& operator=(const TrabalhadorFase1&);
+};
+
+int dividirEmLotes(const double* tempos, int n, double delta, int tamanho_minimo, int* limites);
+Corrida* agruparBase(DemandaStore& demandas, const ParametrosFase1& parametros, TrabalhadorFase1& trabalhador,
+                     int i, int fim);
+void agruparLote(DemandaStore& demandas, const ParametrosFase1& parametros, TrabalhadorFase1& trabalhador,
+                 int inicio, int fim, Corrida** corridas_por_base);
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+
+// Alocador por incremento de ponteiro (bump allocator). Os objetos não são
+// liberados individualmente: a arena inteira é descartada no destrutor ou
+// reaproveitada com reiniciar(), ambos em tempo proporcional ao número de
+// blocos reservados e não ao número de objetos.
+class Arena {
+private:
+    struct Bloco {
+        Bloco* proximo;         // Próximo bloco da lista
+        size_t capacidade;      // Bytes utilizáveis após o cabeçalho
+        size_t usado;           // Bytes já entregues deste bloco
+    };
+
+    Bloco* primeiro;            // Primeiro bloco reservado
+    Bloco* atual;               // Bloco de onde saem as próximas alocações
+    size_t tamanho_bloco;       // Capacidade padrão de um bloco novo
+
+    // Estatísticas
+    size_t bytes_em_uso;        // Bytes entregues desde o último reinício
+    size_t pico_bytes;          // Maior valor de bytes_em_uso já observado
+    size_t bytes_reservados;    // Soma das capacidades dos blocos
+    long long total_alocacoes;  // Número de chamadas a alocar()
+    int total_reinicios;        // Número de chamadas a reiniciar()
+
+public:
+    // Construtor
+    Arena();
+    Arena(size_t tamanho_bloco);
+
+    // Destrutor
+    ~Arena();
+
+    // Operações principais
+    void* alocar(size_t bytes, size_t alinhamento);
+    void reiniciar();
+
+    // Estatísticas
+    size_t getBytesEmUso() const;
+    size_t getPicoBytes() const;
+    size_t getBytesReservados() const;
+    long long getTotalAlocacoes() const;
+    int getTotalReinicios() const;
+
+private:
+    Arena(const Arena&);
+    Arena& operator=(const Arena&);
+
+    Bloco* novoBloco(size_t capacidade);
+};
+
+// Permite construir objetos na arena: new (arena) Tipo(...)
+void* operator new(size_t bytes, Arena& arena);
+void* operator new[](size_t bytes, Arena& arena);
+void operator delete(void* ponteiro, Arena& arena);
+void operator delete[](void* ponteiro, Arena& arena);
+
+#endif
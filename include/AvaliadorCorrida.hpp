@@ -0,0 +1,71 @@
+#ifndef AVALIADOR_CORRIDA_HPP
+#define AVALIADOR_CORRIDA_HPP
+
+#include "Demanda.hpp"
+
+// Avalia a rota de um grupo de demandas (todas as origens na ordem do grupo,
+// depois todos os destinos) sem construir a Corrida. Mantém as distâncias já
+// calculadas, de modo que avaliar a adição de uma demanda custa três raízes
+// quadradas e nenhuma alocação. A soma não é O(1): na rota, os trechos
+// entre destinos vêm depois dos que dependem do candidato (origem nova e
+// travessia até o primeiro destino), e um total acumulado deles
+// arredondaria em outra ordem. Por isso são somados de novo a cada
+// avaliação (O(membros) adições), na mesma ordem de
+// Corrida::calcularDuracaoDistancia, para resultados idênticos bit a bit aos
+// da corrida construída. Só a soma das origens, que precede os destinos na
+// rota, é mantida acumulada.
+class AvaliadorCorrida {
+private:
+    const DemandaStore* demandas;
+    int capacidade;                 // Número máximo de demandas no grupo
+
+    int* membros;                   // Índices (no store) das demandas do grupo
+    double* trechos_destino;        // trechos_destino[k] = dist(d[k-1], d[k])
+    int num_membros;
+
+    double soma_origens;            // Soma dos trechos entre origens, em ordem
+    double soma_individuais;        // Soma das distâncias individuais, em ordem
+
+    // Último candidato avaliado (reaproveitado por adicionar())
+    int candidato;
+    double candidato_trecho_origem;
+    double candidato_trecho_destino;
+    bool candidato_tem_rota;        // Rota completa já conhecida (grupo de um membro)
+    double candidato_rota;
+
+public:
+    // Construtor
+    AvaliadorCorrida(const DemandaStore* demandas, int capacidade);
+
+    // Destrutor
+    ~AvaliadorCorrida();
+
+    // Operações principais
+    void iniciar(int demanda);
+    double calcularDistanciaComAdicao(int demanda);
+    double calcularEficienciaComAdicao(int demanda);
+    void adicionar(int demanda);
+
+    // Fornece trechos já calculados (último membro -> demanda) e, para um
+    // grupo de um só membro, a rota do par, dispensando as raízes
+    void informarCandidato(int demanda, double trecho_origem, double trecho_destino, double rota_par);
+
+    // Copia o grupo de outro avaliador de mesma capacidade (para seguir
+    // com ele por outro caminho sem refazer as distâncias)
+    void copiarDe(const AvaliadorCorrida& outro);
+
+    // Getters
+    const int* getMembros() const;
+    int getNumMembros() const;
+    double getDistanciaTotal() const;
+    double getEficiencia() const;
+
+private:
+    AvaliadorCorrida(const AvaliadorCorrida&);
+    AvaliadorCorrida& operator=(const AvaliadorCorrida&);
+
+    void avaliarCandidato(int demanda);
+    double somarRota(double trecho_origem, int origem_final, double trecho_destino) const;
+};
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef CONFIGURACOES_VARREDURA_HPP
+#define CONFIGURACOES_VARREDURA_HPP
+
+// Parâmetros de uma configuração da varredura, na ordem da entrada
+enum ParametroVarredura {
+    PARAMETRO_ETA = 0,
+    PARAMETRO_GAMA = 1,
+    PARAMETRO_DELTA = 2,
+    PARAMETRO_ALFA = 3,
+    PARAMETRO_BETA = 4,
+    PARAMETRO_LAMBDA = 5,
+    NUM_PARAMETROS_VARREDURA = 6
+};
+
+struct ConfiguracaoVarredura {
+    double valores[NUM_PARAMETROS_VARREDURA];
+    unsigned char herdados;     // Bit p: valor p vem do cabeçalho do conjunto
+    int conjunto;               // Conjunto de demandas (ver getCaminhoConjunto)
+};
+
+// Lista de configurações de uma varredura de parâmetros (--varredura).
+// Cada linha do arquivo tem os seis parâmetros da entrada e, opcionalmente,
+// o arquivo de demandas:
+//
+//   eta gama delta alfa beta lambda [arquivo]
+//
+// Cada campo é um número, um intervalo "inicio:fim:pontos" (pontos valores
+// igualmente espaçados, extremos incluídos) ou "-", o valor do cabeçalho do
+// arquivo de demandas. Uma linha com intervalos gera o produto cartesiano
+// dos valores, com lambda variando mais rápido. Sem arquivo, as demandas
+// vêm da entrada padrão. Linhas vazias e iniciadas por '#' são ignoradas.
+class ConfiguracoesVarredura {
+private:
+    ConfiguracaoVarredura* configuracoes;
+    int num_configuracoes;
+    int capacidade_configuracoes;
+
+    char** caminhos;            // Caminho de cada conjunto (nullptr = entrada padrão)
+    int num_conjuntos;
+    int capacidade_conjuntos;
+
+    char erro[256];
+
+public:
+    // Limite de configurações geradas por um arquivo
+    static const int MAXIMO_CONFIGURACOES = 10000000;
+
+    // Construtor
+    ConfiguracoesVarredura();
+
+    // Destrutor
+    ~ConfiguracoesVarredura();
+
+    // Lê e expande o arquivo; em caso de erro, getErro() descreve o problema
+    bool carregar(const char* caminho);
+
+    // Getters
+    int getNumConfiguracoes() const;
+    ConfiguracaoVarredura& getConfiguracao(int indice);
+    int getNumConjuntos() const;
+    const char* getCaminhoConjunto(int conjunto) const;
+    const char* getErro() const;
+
+    static const char* getNomeParametro(int parametro);
+
+private:
+    ConfiguracoesVarredura(const ConfiguracoesVarredura&);
+    ConfiguracoesVarredura& operator=(const ConfiguracoesVarredura&);
+
+    bool interpretarLinha(char* linha, int numero_linha);
+    bool interpretarCampo(const char* campo, double& inicio, double& fim, int& pontos);
+    int registrarConjunto(const char* caminho);
+    void adicionar(const ConfiguracaoVarredura& configuracao);
+};
+
+#endif
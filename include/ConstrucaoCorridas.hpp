@@ -0,0 +1,20 @@
+#ifndef CONSTRUCAO_CORRIDAS_HPP
+#define CONSTRUCAO_CORRIDAS_HPP
+
+#include "Arena.hpp"
+#include "Corrida.hpp"
+#include "Demanda.hpp"
+
+// Materialização das corridas, comum às fases 1 e 2, ao modo online e à
+// varredura: as demandas_corrida são índices no store, e a rota é a dos
+// embarques seguidos dos desembarques, na ordem das demandas
+void construirTrechos(Corrida* corrida, double gama);
+Corrida* construirCorrida(const DemandaStore& demandas, const int* demandas_corrida, int num_demandas,
+                          double gama, double tempo_inicio, Arena& arena);
+double calcularEficienciaCorrida(const DemandaStore& demandas, const int* demandas_corrida, int num_demandas,
+                                 double distancia_total);
+double avaliarPorReconstrucao(const DemandaStore& demandas, const int* membros, int num_membros,
+                              int candidata, double gama, double tempo_base, Arena& rascunho);
+double calcularConclusaoDireta(Corrida* corrida, double partida);
+
+#endif
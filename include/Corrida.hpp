@@ -4,19 +4,24 @@
 #include "Trecho.hpp"
 #include "Parada.hpp"
 
+class Arena;
+
 class Corrida {
 private:
+    // Paradas, trechos e IDs ficam em um único bloco alocado de uma vez,
+    // dimensionado pela capacidade (em demandas) informada na construção
+    char* bloco;                // Bloco que contém os três arrays abaixo
+    Arena* arena;               // Arena de onde o bloco vem (nullptr = heap)
+    int capacidade;             // Capacidade em demandas (2x em paradas/trechos)
+    
     int* ids_demandas;          // Array de IDs das demandas satisfeitas
     int num_demandas;           // Número de demandas nesta corrida
-    int capacidade_ids;         // Capacidade alocada para o array
     
-    Trecho** trechos;           // Array de ponteiros para trechos
+    Trecho* trechos;            // Array de trechos (por valor)
     int num_trechos;            // Número de trechos
-    int capacidade_trechos;     // Capacidade alocada para o array
     
-    Parada** paradas;           // Array de todas as paradas da corrida
+    Parada* paradas;            // Array de todas as paradas da corrida (por valor)
     int num_paradas;            // Número total de paradas
-    int capacidade_paradas;     // Capacidade alocada para o array
     
     double duracao_total;       // Duração total da corrida
     double distancia_total;     // Distância total percorrida
@@ -27,6 +32,7 @@ public:
     // Construtor
     Corrida();
     Corrida(int capacidade_inicial);
+    Corrida(int capacidade_inicial, Arena* arena);
     
     // Destrutor
     ~Corrida();
@@ -34,9 +40,9 @@ public:
     // Getters
     int* getIdsDemandas() const;
     int getNumDemandas() const;
-    Trecho** getTrechos() const;
+    Trecho* getTrechos() const;
     int getNumTrechos() const;
-    Parada** getParadas() const;
+    Parada* getParadas() const;
     int getNumParadas() const;
     double getDuracaoTotal() const;
     double getDistanciaTotal() const;
@@ -51,8 +57,8 @@ public:
     
     // Métodos de manipulação
     void adicionarDemanda(int id_demanda);
-    void adicionarTrecho(Trecho* trecho);
-    void adicionarParada(Parada* parada);
+    void adicionarTrecho(const Trecho& trecho);   // Copia o trecho para o bloco
+    void adicionarParada(const Parada& parada);   // Copia a parada para o bloco
     
     // Métodos auxiliares
     void calcularEficiencia(double* distancias_individuais);
@@ -64,12 +70,13 @@ public:
     void limparParadas();                    // Remove todas as paradas
     void reconstruirRota(double velocidade); // Reconstrói trechos/paradas após adicionar demanda
     Corrida* clonar() const;                 // Cria cópia da corrida para teste
+    Corrida* clonar(Arena* arena) const;     // Cria a cópia dentro de uma arena
     
 private:
-    // Métodos auxiliares para redimensionamento
-    void redimensionarIds();
-    void redimensionarTrechos();
-    void redimensionarParadas();
+    // Métodos auxiliares do bloco de armazenamento
+    void alocarBloco(int capacidade);
+    void liberarBloco();
+    void redimensionar();
 };
 
 #endif
\ No newline at end of file
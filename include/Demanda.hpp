@@ -1,9 +1,6 @@
 #ifndef DEMANDA_HPP
 #define DEMANDA_HPP
 
-// Forward declaration para evitar dependência circular
-class Corrida;
-
 enum EstadoDemanda {
     DEMANDADA,
     INDIVIDUAL,
@@ -11,31 +8,86 @@ enum EstadoDemanda {
     CONCLUIDA
 };
 
-class Demanda {
+class Demanda;
+
+// Armazena as demandas em colunas contíguas (estrutura de arrays), de modo
+// que as varreduras das fases de combinação percorram memória sequencial
+class DemandaStore {
 private:
-    int id;
-    double tempo_solicitacao;
-    double origem_x;
-    double origem_y;
-    double destino_x;
-    double destino_y;
-    
-    EstadoDemanda estado;
-    Corrida* corrida_associada;
-    
-    // Estatísticas de execução
-    double tempo_conclusao;
-    double distancia_percorrida;
-    
+    int* ids;                       // IDs das demandas
+    double* tempos;                 // Tempos de solicitação
+    double* origens_x;              // Coordenadas das origens
+    double* origens_y;
+    double* destinos_x;             // Coordenadas dos destinos
+    double* destinos_y;
+    unsigned char* estados;         // EstadoDemanda de cada demanda
+    int* indices_corrida;           // Índice da corrida associada (-1 se nenhuma)
+
+    int tamanho;                    // Número de demandas armazenadas
+    int capacidade;                 // Capacidade alocada das colunas
+
 public:
     // Construtor
-    Demanda();
-    Demanda(int id, double tempo, double ox, double oy, double dx, double dy);
-    
+    DemandaStore();
+    DemandaStore(int capacidade_inicial);
+
     // Destrutor
-    ~Demanda();
+    ~DemandaStore();
+
+    // Inserção
+    void adicionar(int id, double tempo, double ox, double oy, double dx, double dy);
     
+    // Remove as primeiras demandas, deslocando as demais para o início
+    // (os índices de todas diminuem em quantidade)
+    void descartarPrimeiras(int quantidade);
+
+    // Visão sobre uma demanda
+    Demanda getDemanda(int indice);
+
+    // Acesso às colunas
+    int getTamanho() const;
+    const int* getIds() const;
+    const double* getTempos() const;
+    const double* getOrigensX() const;
+    const double* getOrigensY() const;
+    const double* getDestinosX() const;
+    const double* getDestinosY() const;
+    const unsigned char* getEstados() const;
+
+    // Acesso por índice
+    int getId(int indice) const;
+    double getTempoSolicitacao(int indice) const;
+    double getOrigemX(int indice) const;
+    double getOrigemY(int indice) const;
+    double getDestinoX(int indice) const;
+    double getDestinoY(int indice) const;
+    EstadoDemanda getEstado(int indice) const;
+    int getIndiceCorrida(int indice) const;
+
+    void setEstado(int indice, EstadoDemanda estado);
+    void setIndiceCorrida(int indice, int indice_corrida);
+
+    // Métodos auxiliares
+    double calcularDistanciaOrigem(int indice, int outra) const;
+    double calcularDistanciaDestino(int indice, int outra) const;
+    double calcularDistanciaCorrida(int indice) const;
+
+private:
+    void redimensionar();
+};
+
+// Visão leve sobre uma demanda do DemandaStore; mantém a interface da Demanda
+class Demanda {
+private:
+    DemandaStore* store;
+    int indice;
+
+public:
+    // Construtor
+    Demanda(DemandaStore* store, int indice);
+
     // Getters
+    int getIndice() const;
     int getId() const;
     double getTempoSolicitacao() const;
     double getOrigemX() const;
@@ -43,20 +95,16 @@ public:
     double getDestinoX() const;
     double getDestinoY() const;
     EstadoDemanda getEstado() const;
-    Corrida* getCorridaAssociada() const;
-    double getTempoConclusao() const;
-    double getDistanciaPercorrida() const;
-    
+    int getIndiceCorrida() const;
+
     // Setters
     void setEstado(EstadoDemanda novo_estado);
-    void setCorridaAssociada(Corrida* corrida);
-    void setTempoConclusao(double tempo);
-    void setDistanciaPercorrida(double distancia);
-    
+    void setIndiceCorrida(int indice_corrida);
+
     // Métodos auxiliares
     double calcularDistanciaOrigem(const Demanda& outra) const;
     double calcularDistanciaDestino(const Demanda& outra) const;
     double calcularDistanciaCorrida() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,51 @@
+#ifndef DESPACHO_SIMULADO_HPP
+#define DESPACHO_SIMULADO_HPP
+
+#include "Arena.hpp"
+#include "Corrida.hpp"
+#include "Demanda.hpp"
+#include "Escalonador.hpp"
+#include "IndiceCorridas.hpp"
+#include "InsercaoDinamica.hpp"
+#include "TabelaCorridas.hpp"
+
+// Na inserção durante a simulação, cada demanda individual chega ao
+// escalonador no seu tempo e só é oferecida às corridas compartilhadas já
+// em andamento. O veículo está a caminho da parada do evento pendente da
+// corrida: ela e as anteriores ficam como estão, e o restante da rota é
+// replanejado com a demanda nova. As chegadas de um mesmo tempo são
+// despachadas depois dos demais eventos desse tempo, na ordem da entrada,
+// para que o resultado não dependa dos empates da fila.
+struct DespachoSimulado {
+    IndiceCorridas ativas;          // Corridas compartilhadas em andamento, com vaga
+    int* candidatas;                // Resultado das consultas a 'ativas'
+    int* demanda_por_corrida;       // Demanda (no store) de cada corrida individual
+    int* chegadas;                  // Corridas individuais que chegaram em tempo_chegadas
+    int num_chegadas;
+    double tempo_chegadas;
+    int num_ativas;
+    
+    // Estatísticas
+    int total_chegadas;
+    int total_inseridas;
+    long long candidatas_avaliadas;
+    int maior_num_ativas;
+    
+    // Construtor
+    DespachoSimulado(int capacidade);
+    
+    // Destrutor
+    ~DespachoSimulado();
+    
+    // Operações principais
+    void atualizarAtiva(Corrida* corrida, int indice_corrida, int eta, bool em_andamento);
+    
+private:
+    DespachoSimulado(const DespachoSimulado&);
+    DespachoSimulado& operator=(const DespachoSimulado&);
+};
+
+int despacharChegadas(DemandaStore& demandas, TabelaCorridas& corridas, Escalonador& escalonador,
+                      DespachoSimulado& despacho, const ParametrosFase2& parametros, Arena& arena, Arena& rascunho);
+
+#endif
@@ -0,0 +1,17 @@
+#ifndef ENTRADA_DEMANDAS_HPP
+#define ENTRADA_DEMANDAS_HPP
+
+#include "LeitorEntrada.hpp"
+#include "Demanda.hpp"
+
+// Leitura da entrada: cabeçalho (eta, gama, delta, alfa, beta, lambda e o
+// número de demandas) seguido das demandas. Os valores vêm do leitor
+// rápido ou, sem leitor (nullptr), de std::cin
+bool lerValor(LeitorEntrada* leitor, int& valor);
+bool lerValor(LeitorEntrada* leitor, double& valor);
+void validarParametros(int eta, double gama, double delta, double alfa, double beta, double lambda);
+void lerCabecalho(LeitorEntrada* leitor, int& eta, double& gama, double& delta, double& alfa, double& beta,
+                  double& lambda, int& num_demandas);
+void lerDemandas(LeitorEntrada* leitor, int num_demandas, DemandaStore& demandas);
+
+#endif
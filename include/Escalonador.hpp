@@ -2,23 +2,47 @@
 #define ESCALONADOR_HPP
 
 #include "Corrida.hpp"
+#include "EventoPool.hpp"
+#include "FilaCalendario.hpp"
+#include "HeapBinario.hpp"
+#include "HeapDario.hpp"
+
+class Arena;
+
+// Referência geracional a uma corrida de uma TabelaCorridas: deixa de valer
+// quando a corrida daquele índice é substituída ou liberada
+struct ReferenciaCorrida {
+    int indice;                 // -1 = nenhuma corrida
+    unsigned int geracao;
+};
+
+// Handle estável de um evento escalonado: vale até o evento sair da fila
+// (retirado ou removido), mesmo que o evento mude de posição ou de tempo
+struct HandleEvento {
+    int indice;                 // -1 = nenhum evento
+    unsigned int geracao;
+};
 
 enum TipoEvento {
     COLETA_PASSAGEIRO,
-    ENTREGA_PASSAGEIRO
+    ENTREGA_PASSAGEIRO,
+    CHEGADA_DEMANDA          // Demanda individual disponível para inserção
 };
 
 class Evento {
 private:
     double tempo;
     TipoEvento tipo;
-    Corrida* corrida_associada;
+    int ordem_corrida;  // Posição da corrida na junção (-1 = não informada)
+    ReferenciaCorrida corrida_associada;
     int indice_parada; // Índice da próxima parada na corrida
+    int posicao_fila;  // Posição na fila de prioridade (-1 = fora da fila)
+    int handle;        // Entrada na tabela de handles do escalonador
     
 public:
     // Construtor
     Evento();
-    Evento(double tempo, TipoEvento tipo, Corrida* corrida, int indice_parada);
+    Evento(double tempo, TipoEvento tipo, ReferenciaCorrida corrida, int indice_parada);
     
     // Destrutor
     ~Evento();
@@ -26,41 +50,87 @@ public:
     // Getters
     double getTempo() const;
     TipoEvento getTipo() const;
-    Corrida* getCorridaAssociada() const;
+    ReferenciaCorrida getCorridaAssociada() const;
     int getIndiceParada() const;
+    int getOrdemCorrida() const;
+    int getPosicaoFila() const;
+    int getHandle() const;
     
     // Setters
     void setTempo(double tempo);
     void setTipo(TipoEvento tipo);
-    void setCorridaAssociada(Corrida* corrida);
+    void setCorridaAssociada(ReferenciaCorrida corrida);
     void setIndiceParada(int indice);
+    void setOrdemCorrida(int ordem);
+    void setPosicaoFila(int posicao);   // Mantida pela fila de prioridade
+    void setHandle(int handle);         // Mantido pelo escalonador
     
     // Operador de comparação para o heap
     bool operator>(const Evento& outro) const;
 };
 
+enum TipoFilaEventos {
+    FILA_HEAP,               // Heap escolhido em tempo de compilação
+    FILA_CALENDARIO          // Fila de calendário com largura adaptativa
+};
+
+// Heap usado pelo escalonador, escolhido em tempo de compilação
+// (make FILA=daria ARIDADE=d seleciona o heap d-ário)
+#ifdef ESCALONADOR_HEAP_DARIO
+typedef HeapDario FilaEventos;
+#else
+typedef HeapBinario FilaEventos;
+#endif
+
 class Escalonador {
 private:
-    Evento** heap;           // Array de ponteiros para eventos (minheap)
-    int tamanho;             // Número atual de eventos
-    int capacidade;          // Capacidade do heap
+    FilaEventos fila;        // Minheap de eventos ordenado pelo tempo
+    FilaCalendario* calendario; // Usada no lugar do heap (nullptr = heap)
+    Arena* arena_eventos;    // Arena dona dos eventos externos (nullptr = eventos no heap)
+    EventoPool pool;         // Eventos criados pelo próprio escalonador
+    
+    // Handles: entrada de cada evento na fila, com geração incrementada a
+    // cada saída para invalidar handles antigos
+    Evento** eventos_handle;
+    unsigned int* geracoes_handle;
+    int* handles_livres;
+    int num_handles;
+    int num_handles_livres;
+    int capacidade_handles;
     
     // Estatísticas
     int total_eventos_processados;
     int total_eventos_inseridos;
+    int total_eventos_em_lote;   // Parte dos inseridos que veio por insereLote
+    int total_eventos_atualizados;
+    int total_eventos_removidos;
     
 public:
     // Construtor
     Escalonador();
     Escalonador(int capacidade_inicial);
+    Escalonador(int capacidade_inicial, Arena* arena_eventos);
+    Escalonador(int capacidade_inicial, Arena* arena_eventos, TipoFilaEventos tipo_fila);
     
     // Destrutor
     ~Escalonador();
     
     // Operações principais
     void inicializa();
-    void insereEvento(Evento* evento);
+    HandleEvento insereEvento(Evento* evento);
+    HandleEvento insereEvento(double tempo, TipoEvento tipo, ReferenciaCorrida corrida, int indice_parada);
+    void insereLote(Evento* const* eventos, int quantidade);
+    Evento* criaEvento(double tempo, TipoEvento tipo, ReferenciaCorrida corrida, int indice_parada);
     Evento* retiraProximoEvento();
+    
+    // Operações por handle (O(log n) nos heaps; O(1) amortizado no
+    // calendário). Um handle de evento que já saiu da fila é ignorado
+    bool atualizaEvento(HandleEvento handle, double novo_tempo);
+    Evento* removeEvento(HandleEvento handle);   // Devolver com liberaEvento()
+    HandleEvento getHandle(const Evento* evento) const;
+    Evento* getEvento(HandleEvento handle) const; // nullptr se fora da fila
+    
+    void liberaEvento(Evento* evento);
     void finaliza();
     
     // Métodos auxiliares
@@ -71,16 +141,25 @@ public:
     // Estatísticas
     int getTotalEventosProcessados() const;
     int getTotalEventosInseridos() const;
+    int getTotalEventosEmLote() const;
+    int getTotalEventosAtualizados() const;
+    int getTotalEventosRemovidos() const;
+    
+    const EventoPool& getPool() const;
+    
+    // Fila de prioridade em uso
+    const char* getNomeFila() const;
+    const FilaCalendario* getCalendario() const;
     
 private:
-    // Métodos auxiliares do heap
-    void heapifyUp(int indice);
-    void heapifyDown(int indice);
-    void redimensionar();
-    int getPai(int indice) const;
-    int getFilhoEsquerdo(int indice) const;
-    int getFilhoDireito(int indice) const;
-    void trocar(int indice1, int indice2);
+    Escalonador(const Escalonador&);
+    Escalonador& operator=(const Escalonador&);
+    
+    Evento* retirarDaFila();
+    void descartarEventos();
+    void inicializarHandles(int capacidade);
+    void registrarHandle(Evento* evento);
+    void liberarHandle(Evento* evento);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef ESCRITOR_SAIDA_HPP
+#define ESCRITOR_SAIDA_HPP
+
+#include <cstddef>
+#include <ostream>
+
+// Escrita bufferizada da saída: os valores são formatados direto num buffer
+// grande, enviado ao destino em blocos (e no destrutor), em vez de passar
+// por operator<< a cada número e esvaziar o stream a cada linha.
+//
+// escreverDecimal2 produz exatamente o texto de "fixed << setprecision(2)"
+// (e de printf("%.2f")): o double é decomposto em mantissa e expoente e o
+// valor vezes 100 é arredondado em aritmética inteira, com empates exatos
+// indo para o par. Valores fora dessa faixa (|v| >= 2^53, infinitos e
+// NaN) recorrem ao snprintf.
+class EscritorSaida {
+public:
+    static const size_t CAPACIDADE_PADRAO = 1 << 20;
+
+    // Maior texto de escreverDecimal2 ("%.2f" de -DBL_MAX tem 313 caracteres)
+    static const size_t TAMANHO_MAXIMO_DECIMAL = 320;
+
+private:
+    std::ostream& destino;
+    char* buffer;
+    size_t capacidade;
+    size_t usado;
+
+    // Estatísticas
+    unsigned long long bytes_escritos;
+    unsigned long long descargas;
+
+public:
+    // Construtor
+    EscritorSaida(std::ostream& destino, size_t capacidade = CAPACIDADE_PADRAO);
+
+    // Destrutor
+    ~EscritorSaida();
+
+    // Operações principais
+    void escreverCaractere(char caractere);
+    void escreverTexto(const char* texto);
+    void escreverBytes(const void* bytes, size_t tamanho);
+    void escreverInteiro(long long valor);
+    void escreverDecimal2(double valor);
+    void descarregar();
+
+    // Formata em destino (TAMANHO_MAXIMO_DECIMAL bytes) e retorna o número de caracteres
+    static int formatarDecimal2(double valor, char* destino);
+
+    // Estatísticas
+    unsigned long long getBytesEscritos() const;
+    unsigned long long getDescargas() const;
+
+private:
+    EscritorSaida(const EscritorSaida&);
+    EscritorSaida& operator=(const EscritorSaida&);
+
+    void reservar(size_t bytes);
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef EVENTO_POOL_HPP
+#define EVENTO_POOL_HPP
+
+#include <cstddef>
+
+class Evento;
+
+// Pool de eventos: blocos (slabs) com espaço para vários Evento e uma lista
+// livre com os eventos devolvidos. Um evento devolvido é reaproveitado pela
+// próxima criação, de modo que a memória acompanha o pico de eventos vivos
+// e o alocador do sistema só é chamado uma vez por bloco.
+class EventoPool {
+private:
+    struct Slab {
+        Slab* proximo;          // Próximo bloco da lista
+        int usados;             // Eventos já entregues deste bloco
+    };
+
+    struct NoLivre {
+        NoLivre* proximo;       // Ocupa o espaço de um evento devolvido
+    };
+
+    Slab* slabs;                // Bloco mais recente primeiro
+    NoLivre* livres;            // Eventos devolvidos
+    int eventos_por_slab;
+
+    // Estatísticas
+    long long eventos_criados;
+    long long eventos_reciclados; // Criações atendidas pela lista livre
+    long long eventos_vivos;
+    long long pico_vivos;
+    int total_slabs;            // Chamadas ao alocador do sistema
+
+public:
+    // Construtor
+    EventoPool();
+    EventoPool(int eventos_por_slab);
+
+    // Destrutor
+    ~EventoPool();
+
+    // Operações principais
+    Evento* criar(const Evento& modelo);
+    void liberar(Evento* evento);
+    bool contem(const Evento* evento) const;
+
+    // Estatísticas
+    long long getEventosCriados() const;
+    long long getEventosReciclados() const;
+    long long getEventosVivos() const;
+    long long getPicoVivos() const;
+    int getTotalSlabs() const;
+    size_t getBytesReservados() const;
+
+private:
+    EventoPool(const EventoPool&);
+    EventoPool& operator=(const EventoPool&);
+
+    static size_t tamanhoCabecalho();
+    char* dadosSlab(Slab* slab) const;
+    size_t bytesSlab() const;
+};
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef FILA_CALENDARIO_HPP
+#define FILA_CALENDARIO_HPP
+
+class Evento;
+
+// Fila de calendário (R. Brown, 1988): os eventos são distribuídos em
+// "dias" de largura fixa, e o dia d fica no balde d mod num_baldes, numa
+// lista ordenada pelo tempo. A retirada percorre os baldes em ordem de dia,
+// o que dá inserção e retirada O(1) amortizadas quando a largura acompanha
+// o espaçamento entre eventos. A largura é reestimada a partir dos eventos
+// mais próximos sempre que o número de baldes dobra ou cai pela metade.
+//
+// A ordem de retirada é exata: cada entrada guarda o dia inteiro calculado
+// na inserção, e empates de tempo saem na ordem de inserção. A posição de
+// um evento é sua entrada; atualizá-lo ou removê-lo percorre só o seu
+// balde, O(1) amortizado como a inserção.
+class FilaCalendario {
+private:
+    // Entradas (estrutura de arrays com lista livre)
+    double* tempos;
+    long long* dias;
+    Evento** eventos;
+    int* proximos;
+    int capacidade;
+    int livre;                 // Primeira entrada livre (-1 = nenhuma)
+
+    // Calendário
+    int* cabecas;              // Início da lista de cada balde
+    int num_baldes;            // Potência de 2
+    double largura;            // Largura de um dia
+    long long dia_atual;       // Nenhuma entrada tem dia menor
+    int tamanho;
+
+    // Estatísticas
+    int redimensionamentos;
+    int buscas_diretas;        // Voltas no calendário sem achar evento
+
+public:
+    // Construtor
+    FilaCalendario(int capacidade_inicial);
+
+    // Destrutor
+    ~FilaCalendario();
+
+    // Operações principais
+    void inserir(Evento* evento);
+    void inserirLote(Evento* const* eventos, int quantidade);
+    Evento* retirarMinimo();
+    void atualizar(Evento* evento);     // Depois de mudar o tempo do evento
+    void remover(Evento* evento);
+    void limpar();
+
+    // Getters
+    int getTamanho() const;
+    double getTempoMinimo() const;
+    int getNumBaldes() const;
+    double getLargura() const;
+    int getRedimensionamentos() const;
+    int getBuscasDiretas() const;
+
+private:
+    FilaCalendario(const FilaCalendario&);
+    FilaCalendario& operator=(const FilaCalendario&);
+
+    long long calcularDia(double tempo) const;
+    int calcularBalde(long long dia) const;
+    void encadearOrdenado(int entrada);
+    void desencadear(int entrada);
+    int localizarMinimo(bool& busca_direta) const;
+    double estimarLargura() const;
+    void redimensionar(int novo_num_baldes);
+    void crescerEntradas();
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef FORMATO_SAIDA_BINARIA_HPP
+#define FORMATO_SAIDA_BINARIA_HPP
+
+#include <cstdint>
+
+// Formato binário colunar da saída (--formato=binario). O arquivo começa
+// por um cabeçalho fixo seguido de um descritor por coluna; cada coluna é
+// um array contíguo de elementos de largura fixa, começando num
+// deslocamento múltiplo de 8, de modo que o arquivo mapeado em memória
+// pode ser lido direto como arrays de double / int32 / int64:
+//
+//   tempo_conclusao  f64 [n]      distancia_total  f64 [n]
+//   eficiencia       f64 [n]      num_paradas      i32 [n]
+//   inicio_paradas   i64 [n + 1]  coordenadas      f64 [2 * total_paradas]
+//
+// As paradas da corrida i são as de índice inicio_paradas[i] até
+// inicio_paradas[i + 1] - 1, e a parada p está em coordenadas[2p] (x) e
+// coordenadas[2p + 1] (y). Os números são gravados na ordem de bytes da
+// máquina; marca_ordem permite ao leitor recusar um arquivo de outra ordem.
+namespace FormatoSaidaBinaria {
+
+static const char MAGICA[8] = {'T', 'P', '2', 'S', 'A', 'I', 'D', 'A'};
+static const uint32_t VERSAO = 1;
+static const uint32_t MARCA_ORDEM = 0x01020304;
+static const uint32_t NUM_COLUNAS = 6;
+static const uint32_t ALINHAMENTO = 8;
+static const int TAMANHO_NOME = 24;
+
+enum TipoColuna {
+    TIPO_F64 = 1,
+    TIPO_I32 = 2,
+    TIPO_I64 = 3
+};
+
+// Ordem das colunas no arquivo
+enum IndiceColuna {
+    COLUNA_TEMPO_CONCLUSAO = 0,
+    COLUNA_DISTANCIA_TOTAL = 1,
+    COLUNA_EFICIENCIA = 2,
+    COLUNA_NUM_PARADAS = 3,
+    COLUNA_INICIO_PARADAS = 4,
+    COLUNA_COORDENADAS = 5
+};
+
+struct Cabecalho {
+    char magica[8];
+    uint32_t versao;
+    uint32_t marca_ordem;
+    uint64_t num_corridas;
+    uint64_t total_paradas;
+    uint32_t num_colunas;
+    uint32_t tamanho_cabecalho;     // Cabeçalho mais descritores, em bytes
+};
+
+struct DescritorColuna {
+    char nome[TAMANHO_NOME];        // Terminado em '\0'
+    uint32_t tipo;                  // TipoColuna
+    uint32_t largura;               // Bytes por elemento
+    uint64_t deslocamento;          // A partir do início do arquivo
+    uint64_t elementos;
+};
+
+static_assert(sizeof(Cabecalho) == 40, "Cabecalho deve ter 40 bytes");
+static_assert(sizeof(DescritorColuna) == 48, "DescritorColuna deve ter 48 bytes");
+
+}
+
+#endif
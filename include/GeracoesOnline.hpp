@@ -0,0 +1,58 @@
+#ifndef GERACOES_ONLINE_HPP
+#define GERACOES_ONLINE_HPP
+
+#include <cstddef>
+#include "Arena.hpp"
+
+struct GeracaoCorridas {
+    Arena* arena;
+    int pendentes;                  // Corridas da geração ainda não escritas
+};
+
+// Gerações das corridas do modo online: cada corrida é construída na
+// geração atual, e uma geração fechada cujas corridas já foram todas
+// escritas é reiniciada e reaproveitada. A geração de cada corrida fica
+// registrada pelo seu índice na TabelaCorridas
+class GeracoesOnline {
+public:
+    // Corridas por geração de arena: quando todas as corridas de uma
+    // geração fechada foram escritas, a arena é reiniciada e volta a ser usada
+    static const int CORRIDAS_POR_GERACAO = 4096;
+
+private:
+    GeracaoCorridas* geracoes;
+    int num_geracoes;
+    int capacidade;
+    int* livres;                    // Gerações prontas para reaproveitar
+    int num_livres;
+    int atual;
+    int corridas_atual;             // Corridas construídas na geração atual
+    int pico_em_uso;
+    int* geracao_por_corrida;       // Geração de cada índice da TabelaCorridas
+    int capacidade_corridas;
+
+public:
+    // Construtor
+    GeracoesOnline();
+
+    // Destrutor
+    ~GeracoesOnline();
+
+    // Operações principais
+    void registrarCorrida(int indice_corrida);
+    void liberarCorrida(int indice_corrida);
+
+    // Getters
+    Arena* getArenaAtual() const;
+    int getNumGeracoes() const;
+    int getPicoEmUso() const;
+    size_t getBytesReservados() const;
+
+private:
+    GeracoesOnline(const GeracoesOnline&);
+    GeracoesOnline& operator=(const GeracoesOnline&);
+
+    void abrirGeracao();
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef GRADE_ESPACIAL_HPP
+#define GRADE_ESPACIAL_HPP
+
+#include "Demanda.hpp"
+
+// Índice espacial em grade uniforme, particionado em faixas de tempo, sobre
+// as origens e os destinos das demandas. Para uma demanda i, devolve em ordem
+// crescente as demandas da janela temporal de i (as seguintes com
+// tempo - tempo_i < delta) cuja origem está em célula vizinha à de i (células
+// de lado ~alfa) e cujo destino está em célula vizinha ao de i (lado ~beta).
+// Qualquer demanda descartada está a mais de alfa/beta de i e, portanto,
+// seria rejeitada pelos critérios de compartilhamento.
+class GradeEspacial {
+private:
+    bool habilitada;            // false se os tempos não estiverem ordenados
+
+    int* celula_origem_x;       // Célula da origem de cada demanda
+    int* celula_origem_y;
+    int* celula_destino_x;      // Célula do destino de cada demanda
+    int* celula_destino_y;
+    int* limite_janela;         // Primeiro índice fora da janela de cada demanda
+    int* faixas;                // Faixa de tempo (largura delta) de cada demanda
+
+    int* cabecas;               // Tabela hash (faixa, célula) -> primeira demanda
+    int* proximos;              // Próxima demanda na mesma cadeia da tabela
+    int tamanho_tabela;         // Potência de 2
+
+public:
+    // Construtor
+    GradeEspacial(const DemandaStore* demandas, double delta, double alfa, double beta);
+
+    // Destrutor
+    ~GradeEspacial();
+
+    // Consulta: escreve em 'saida' (capacidade >= tamanho da janela) as
+    // candidatas de i em ordem crescente e retorna quantas são
+    int buscarCandidatas(int indice, int* saida) const;
+
+    // Getters
+    bool estaHabilitada() const;
+    int getLimiteJanela(int indice) const;
+
+private:
+    GradeEspacial(const GradeEspacial&);
+    GradeEspacial& operator=(const GradeEspacial&);
+
+    int calcularSlot(int faixa, int celula_x, int celula_y) const;
+};
+
+#endif
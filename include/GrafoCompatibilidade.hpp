@@ -0,0 +1,82 @@
+#ifndef GRAFO_COMPATIBILIDADE_HPP
+#define GRAFO_COMPATIBILIDADE_HPP
+
+#include "Demanda.hpp"
+
+// Origem das distâncias entre demandas na fase 1
+enum ModoCompatibilidade {
+    COMPATIBILIDADE_AUTOMATICA,     // Grafo só na varredura, onde é reaproveitado
+    COMPATIBILIDADE_DIRETA,         // Sempre calculadas (grade/verificador)
+    COMPATIBILIDADE_GRAFO           // Sempre pelo grafo, quando disponível
+};
+
+// Grafo esparso de compatibilidade entre pares de demandas, construído uma
+// vez para limites (delta, alfa, beta) e reaproveitado por qualquer execução
+// com limites menores ou iguais. As arestas de i são as demandas j > i da
+// janela temporal de i com distância entre origens <= alfa e entre destinos
+// <= beta, em ordem crescente de índice (e, com os tempos ordenados, de
+// tempo): o limite delta de uma execução é um prefixo da lista, e alfa/beta
+// um filtro sobre as distâncias guardadas. Cada aresta guarda as distâncias
+// entre origens e entre destinos e a rota do par (o_i, o_j, d_i, d_j), com
+// as mesmas operações do AvaliadorCorrida, portanto idênticas bit a bit.
+// Cada lista guarda também as menores distâncias entre origens e entre
+// destinos das suas arestas: com alfa/beta abaixo delas nenhuma aresta
+// passa no filtro e a lista inteira é pulada.
+// Só a fase 1 (e a varredura) usa o grafo; a fase 2 testa cada demanda
+// individual contra as corridas já formadas, que o grafo não descreve.
+class GrafoCompatibilidade {
+private:
+    bool habilitado;            // false: tempos fora de ordem ou arestas demais
+    bool arestas_excedidas;     // Desabilitado por passar de MAXIMO_ARESTAS
+    int num_demandas;
+    double delta, alfa, beta;   // Limites de construção
+
+    long long* inicio_arestas;  // Arestas de i em [inicio[i], inicio[i + 1])
+    int* vizinhos;
+    double* distancias_origem;
+    double* distancias_destino;
+    double* rotas;
+    double* menores_origem;     // Menor distância entre origens da lista de i
+    double* menores_destino;    // Menor distância entre destinos da lista de i
+    long long num_arestas;
+    long long capacidade;
+
+public:
+    // Acima deste número de arestas o grafo é descartado (memória)
+    static const long long MAXIMO_ARESTAS = 1LL << 24;
+
+    // Construtor
+    GrafoCompatibilidade(const DemandaStore* demandas, double delta, double alfa, double beta);
+
+    // Destrutor
+    ~GrafoCompatibilidade();
+
+    // Consulta: índice da aresta (i, j), com i < j, ou -1 se não existir
+    long long buscarAresta(int demanda, int vizinho) const;
+
+    // true se o grafo contém todos os pares compatíveis sob estes limites
+    bool cobre(double delta, double alfa, double beta) const;
+
+    // false se nenhuma aresta da demanda passa em alfa/beta (lista pulada)
+    bool temCandidatas(int demanda, double alfa, double beta) const;
+
+    // Getters
+    bool estaHabilitado() const;
+    bool excedeuArestas() const;
+    long long getInicio(int demanda) const;
+    long long getFim(int demanda) const;
+    long long getNumArestas() const;
+    const int* getVizinhos() const;
+    const double* getDistanciasOrigem() const;
+    const double* getDistanciasDestino() const;
+    const double* getRotas() const;
+
+private:
+    GrafoCompatibilidade(const GrafoCompatibilidade&);
+    GrafoCompatibilidade& operator=(const GrafoCompatibilidade&);
+
+    void adicionarAresta(int vizinho, double distancia_origem, double distancia_destino, double rota);
+    void descartar();
+};
+
+#endif
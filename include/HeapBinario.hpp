@@ -0,0 +1,51 @@
+#ifndef HEAP_BINARIO_HPP
+#define HEAP_BINARIO_HPP
+
+class Evento;
+
+// Minheap binário de ponteiros para eventos, ordenado pelo tempo. Cada
+// comparação lê o tempo dentro dos dois eventos apontados. A posição de
+// cada evento no heap fica no próprio evento, para atualizações e remoções
+// em O(log n).
+class HeapBinario {
+private:
+    Evento** heap;           // Array de ponteiros para eventos (minheap)
+    int tamanho;             // Número atual de eventos
+    int capacidade;          // Capacidade do heap
+
+public:
+    // Construtor
+    HeapBinario(int capacidade_inicial);
+
+    // Destrutor
+    ~HeapBinario();
+
+    // Operações principais
+    void inserir(Evento* evento);
+    void inserirLote(Evento* const* eventos, int quantidade);
+    Evento* retirarMinimo();
+    void atualizar(Evento* evento);     // Depois de mudar o tempo do evento
+    void remover(Evento* evento);
+    void limpar();
+
+    // Getters
+    int getTamanho() const;
+    double getTempoMinimo() const;
+    Evento* getEvento(int indice) const;
+
+private:
+    HeapBinario(const HeapBinario&);
+    HeapBinario& operator=(const HeapBinario&);
+
+    // Métodos auxiliares do heap
+    void heapifyUp(int indice);
+    void heapifyDown(int indice);
+    void reposicionar(int indice);
+    void redimensionar();
+    int getPai(int indice) const;
+    int getFilhoEsquerdo(int indice) const;
+    int getFilhoDireito(int indice) const;
+    void trocar(int indice1, int indice2);
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef HEAP_DARIO_HPP
+#define HEAP_DARIO_HPP
+
+// Número de filhos de cada nó (configurável em tempo de compilação)
+#ifndef ARIDADE_HEAP
+#define ARIDADE_HEAP 4
+#endif
+
+class Evento;
+
+// Minheap d-ário cujas entradas guardam o tempo junto do ponteiro para o
+// evento. As comparações leem apenas o array de entradas: com d = 4 os
+// filhos de um nó ocupam exatamente uma linha de cache de 64 bytes, e a
+// altura cai pela metade em relação ao heap binário. Cada entrada movida
+// grava sua nova posição no evento, para atualizações e remoções em
+// O(log n).
+class HeapDario {
+public:
+    static const int ARIDADE = ARIDADE_HEAP;
+
+    struct Entrada {
+        double tempo;
+        Evento* evento;
+    };
+
+private:
+    char* bloco;                // Memória reservada (com folga de alinhamento)
+    Entrada* entradas;          // Entradas do heap, filhos de i em d*i+1 .. d*i+d
+    int tamanho;
+    int capacidade;
+
+public:
+    // Construtor
+    HeapDario(int capacidade_inicial);
+
+    // Destrutor
+    ~HeapDario();
+
+    // Operações principais
+    void inserir(Evento* evento);
+    void inserirLote(Evento* const* eventos, int quantidade);
+    Evento* retirarMinimo();
+    void atualizar(Evento* evento);     // Depois de mudar o tempo do evento
+    void remover(Evento* evento);
+    void limpar();
+
+    // Getters
+    int getTamanho() const;
+    double getTempoMinimo() const;
+    Evento* getEvento(int indice) const;
+
+private:
+    HeapDario(const HeapDario&);
+    HeapDario& operator=(const HeapDario&);
+
+    void subir(int indice, Entrada entrada);
+    void descer(int indice, Entrada entrada);
+    void reposicionar(int indice, Entrada entrada);
+    void alocar(int capacidade);
+    void redimensionar();
+    void redimensionar(int nova_capacidade);
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef INDICE_CORRIDAS_HPP
+#define INDICE_CORRIDAS_HPP
+
+// Índice espacial dinâmico sobre as corridas candidatas da inserção
+// dinâmica, em grade uniforme sobre um ponto de cada corrida (o último
+// destino). Corridas sem ponto confiável ficam numa lista global devolvida
+// por toda consulta. As listas de cada célula são duplamente encadeadas
+// pelos próprios índices das corridas, de modo que inserir e remover custam
+// O(1) e não alocam memória.
+class IndiceCorridas {
+private:
+    double lado_celula;
+    int capacidade;                 // Índices de corrida válidos: [0, capacidade)
+
+    int* cabecas;                   // Tabela hash célula -> primeira corrida
+    int tamanho_tabela;             // Potência de 2
+    int cabeca_global;              // Corridas devolvidas por toda consulta
+
+    int* proximos;                  // Listas duplamente encadeadas
+    int* anteriores;
+    int* celulas_x;                 // Célula de cada corrida indexada
+    int* celulas_y;
+    unsigned char* situacoes;       // FORA, NA_GRADE ou GLOBAL
+
+public:
+    // Construtor
+    IndiceCorridas(int capacidade, double lado_celula);
+
+    // Destrutor
+    ~IndiceCorridas();
+
+    // Operações principais
+    void inserir(int corrida, double x, double y);
+    void inserirGlobal(int corrida);
+    void remover(int corrida);
+
+    // Escreve em 'saida' (capacidade >= capacidade do índice) as corridas
+    // globais e as das células que cobrem o quadrado de lado 2 * raio
+    // centrado em (x, y); a ordem não é definida
+    int buscar(double x, double y, double raio, int* saida) const;
+
+    // true se a corrida estiver entre as devolvidas por buscar(x, y, raio)
+    bool estaNoAlcance(int corrida, double x, double y, double raio) const;
+
+    // Getters
+    bool estaNaGrade(int corrida) const;
+    bool contem(int corrida) const;
+
+private:
+    IndiceCorridas(const IndiceCorridas&);
+    IndiceCorridas& operator=(const IndiceCorridas&);
+
+    int calcularCelula(double coordenada) const;
+    int calcularSlot(int celula_x, int celula_y) const;
+    void encadear(int corrida, int* cabeca);
+};
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef INSERCAO_DINAMICA_HPP
+#define INSERCAO_DINAMICA_HPP
+
+#include "Arena.hpp"
+#include "Corrida.hpp"
+#include "Demanda.hpp"
+#include "IndiceCorridas.hpp"
+#include "TabelaCorridas.hpp"
+
+// Fase 2: cada demanda individual é oferecida às corridas compartilhadas
+// com vaga e entra na de menor desvio que mantenha a eficiência mínima. A
+// execução em lote a faz antes da simulação (em sequência ou em lotes
+// especulativos), a varredura para cada configuração, e a inserção durante
+// a simulação (DespachoSimulado) usa os mesmos critérios
+
+// Distância máxima de desvio aceitável numa inserção
+const double DESVIO_MAXIMO_ABSOLUTO = 1500.0;
+
+// Folga absoluta do limite inferior do desvio: cobre os arredondamentos das
+// somas de rotas indexáveis (ver registrarCorridaIndice)
+const double MARGEM_LIMITE_DESVIO = 1e-3;
+
+// Maior (paradas x comprimento) de uma corrida indexável; acima disso os
+// arredondamentos poderiam superar MARGEM_LIMITE_DESVIO
+const double LIMITE_ARREDONDAMENTO_ROTA = 1e11;
+
+struct ParametrosFase2 {
+    int eta;
+    double gama, lambda;
+    double desvio_maximo;           // Desvio máximo aceitável
+    bool reportar_insercoes;        // Reporta em cerr cada demanda inserida
+};
+
+struct InsercaoEscolhida {
+    int corrida;                    // -1 se nenhuma corrida aceita a demanda
+    double custo;
+};
+
+void registrarCorridaIndice(IndiceCorridas& indice, const DemandaStore& demandas, Corrida* corrida,
+                            int indice_corrida, int eta);
+bool melhoraInsercao(const InsercaoEscolhida& atual, int corrida, double custo, double eficiencia,
+                     const ParametrosFase2& parametros);
+InsercaoEscolhida nenhumaInsercao(const ParametrosFase2& parametros);
+double raioBuscaInsercao(const ParametrosFase2& parametros);
+void confirmarInsercao(DemandaStore& demandas, TabelaCorridas& corridas, int demanda,
+                       const InsercaoEscolhida& escolha, Corrida* nova_corrida, const ParametrosFase2& parametros);
+int inserirSequencial(DemandaStore& demandas, TabelaCorridas& corridas, int num_corridas, IndiceCorridas* indice,
+                      const int* pendentes, int num_pendentes, const ParametrosFase2& parametros,
+                      Arena& arena, Arena& rascunho);
+int inserirEmParalelo(DemandaStore& demandas, TabelaCorridas& corridas, int num_corridas, IndiceCorridas& indice,
+                      const int* pendentes, int num_pendentes, const ParametrosFase2& parametros,
+                      int num_threads, Arena& arena, Arena& rascunho, int& reavaliacoes);
+
+#endif
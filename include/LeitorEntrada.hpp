@@ -0,0 +1,54 @@
+#ifndef LEITOR_ENTRADA_HPP
+#define LEITOR_ENTRADA_HPP
+
+#include <cstddef>
+
+// Leitor de entrada sem alocação por token: mapeia o arquivo em memória
+// (quando a entrada é um arquivo regular) ou lê em blocos grandes (pipes,
+// terminais), e converte inteiros e decimais diretamente do buffer.
+class LeitorEntrada {
+private:
+    int descritor;              // Descritor de onde os dados são lidos
+
+    const char* dados;          // Início da janela de dados disponível
+    size_t posicao;             // Posição atual dentro da janela
+    size_t fim;                 // Fim da janela de dados
+
+    char* mapeamento;           // Região mapeada (modo mmap) ou nullptr
+    size_t tamanho_mapeamento;  // Tamanho da região mapeada
+
+    char* buffer;               // Buffer de leitura em blocos (modo bloco)
+    size_t capacidade_buffer;   // Capacidade do buffer
+    bool fim_arquivo;           // Não há mais dados a ler do descritor
+
+    int linha;                  // Linha atual (para mensagens de erro)
+
+public:
+    // Tokens até este tamanho são convertidos sem alocação; os maiores
+    // (zeros à esquerda, muitas casas decimais) vão para uma cópia no heap
+    static const size_t TAMANHO_TOKEN_CURTO = 128;
+
+    // Construtor
+    LeitorEntrada(int descritor);
+
+    // Destrutor
+    ~LeitorEntrada();
+
+    // Leitura de valores (retornam false em caso de token ausente ou malformado)
+    bool lerInteiro(int& valor);
+    bool lerDecimal(double& valor);
+
+    // Getters
+    int getLinha() const;
+    bool usaMapeamento() const;
+
+private:
+    // Métodos auxiliares
+    bool mapearArquivo();
+    bool recarregar();
+    void ampliarBuffer();
+    bool garantirDados(size_t quantidade);
+    bool proximoToken(const char*& inicio, const char*& termino);
+};
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef LEITOR_SAIDA_BINARIA_HPP
+#define LEITOR_SAIDA_BINARIA_HPP
+
+#include "FormatoSaidaBinaria.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// Leitor do formato binário colunar: mapeia o arquivo em memória (arquivos
+// regulares) ou o lê inteiro num buffer alinhado (pipes), valida o
+// cabeçalho e localiza as colunas pelo nome. As colunas são expostas como
+// ponteiros para os próprios dados, sem conversão nem cópia.
+class LeitorSaidaBinaria {
+private:
+    char* mapeamento;           // Região mapeada (modo mmap) ou nullptr
+    uint64_t* buffer;           // Dados lidos (modo leitura), alinhados a 8
+    const char* dados;
+    size_t tamanho;
+    const char* erro;           // nullptr se o arquivo é válido
+
+    uint64_t num_corridas;
+    uint64_t total_paradas;
+    const void* colunas[FormatoSaidaBinaria::NUM_COLUNAS];
+
+public:
+    // Construtor
+    LeitorSaidaBinaria(int descritor);
+
+    // Destrutor
+    ~LeitorSaidaBinaria();
+
+    // Validação
+    bool valido() const;
+    const char* getErro() const;
+    bool verificarParadas() const;  // inicio_paradas coerente com num_paradas
+
+    // Getters
+    uint64_t getNumCorridas() const;
+    uint64_t getTotalParadas() const;
+    const double* getTemposConclusao() const;
+    const double* getDistanciasTotais() const;
+    const double* getEficiencias() const;
+    const int32_t* getNumParadas() const;
+    const int64_t* getInicioParadas() const;
+    const double* getCoordenadas() const;
+
+private:
+    LeitorSaidaBinaria(const LeitorSaidaBinaria&);
+    LeitorSaidaBinaria& operator=(const LeitorSaidaBinaria&);
+
+    // Métodos auxiliares
+    bool mapearArquivo(int descritor);
+    bool lerTudo(int descritor);
+    const char* interpretar();
+    const char* localizarColuna(const FormatoSaidaBinaria::DescritorColuna& descritor);
+};
+
+#endif
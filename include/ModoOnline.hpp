@@ -0,0 +1,15 @@
+#ifndef MODO_ONLINE_HPP
+#define MODO_ONLINE_HPP
+
+#include "Agrupamento.hpp"
+#include "LeitorEntrada.hpp"
+#include "OpcoesExecucao.hpp"
+
+// Modo online (--online): agrupa as demandas à medida que são lidas e
+// escreve cada corrida quando nenhuma outra pode concluir antes dela, com
+// memória proporcional à janela ativa. Não faz a fase 2, então a saída
+// pode diferir da execução em lote (avisado em cerr)
+void executarOnline(LeitorEntrada* leitor, int num_demandas, const ParametrosFase1& parametros,
+                    const OpcoesExecucao& opcoes);
+
+#endif
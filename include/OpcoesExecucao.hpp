@@ -0,0 +1,35 @@
+#ifndef OPCOES_EXECUCAO_HPP
+#define OPCOES_EXECUCAO_HPP
+
+#include "Escalonador.hpp"
+#include "GrafoCompatibilidade.hpp"
+#include "VerificadorCompatibilidade.hpp"
+
+// Opções da linha de comando (--opcao=valor)
+struct OpcoesExecucao {
+    bool leitura_stream;    // Lê a entrada com std::cin em vez do LeitorEntrada
+    bool somente_leitura;   // Encerra logo após a leitura da entrada
+    bool exibir_tempos;     // Reporta em cerr o tempo gasto em cada etapa
+    bool avaliacao_reconstrucao; // Fase 1 constrói cada corrida candidata inteira
+    bool indice_linear;     // Fase 1 percorre a janela inteira, sem a grade espacial
+    ConjuntoInstrucoes isa; // Núcleo usado nos critérios de distância
+    int threads;            // Threads das fases 1 e 2 (1 = sequencial)
+    bool insercao_linear;   // Fase 2 testa todas as corridas, sem o índice espacial
+    bool insercao_simulada; // Fase 2 durante a simulação, nas corridas em andamento
+    TipoFilaEventos fila;   // Fila de prioridade da simulação
+    bool simulacao_eventos; // Simula parada a parada em vez do avanço direto
+    bool rastreio;          // Reporta em cerr cada parada simulada
+    bool saida_continua;    // Escreve cada corrida ao concluir, sem ordenar no fim
+    bool escrita_iostream;  // Formata a saída com operator<< em vez do EscritorSaida
+    bool formato_binario;   // Grava a saída no formato binário colunar
+    bool online;            // Consome as demandas como fluxo, com memória limitada
+    const char* varredura;  // Arquivo de configurações da varredura (nullptr = execução única)
+    ModoCompatibilidade compatibilidade; // Distâncias da fase 1 pelo grafo ou calculadas
+    bool cenarios_individuais; // Varredura sem agrupar as configurações por lambda
+};
+
+// Lê e valida as opções; uma opção desconhecida ou uma combinação
+// incompatível lança ParametroInvalidoException
+OpcoesExecucao lerOpcoes(int argc, char** argv);
+
+#endif
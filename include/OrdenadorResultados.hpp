@@ -0,0 +1,57 @@
+#ifndef ORDENADOR_RESULTADOS_HPP
+#define ORDENADOR_RESULTADOS_HPP
+
+#include <cstdint>
+
+class Corrida;
+
+struct ResultadoCorrida {
+    double tempo_conclusao;
+    Corrida* corrida;
+};
+
+// Ordenação dos resultados por tempo de conclusão com radix sort LSD sobre
+// os bits IEEE-754 do tempo: o double é mapeado para um inteiro de 64 bits
+// com a mesma ordem (inverte todos os bits dos negativos, liga o bit de
+// sinal dos positivos) e ordenado por dígitos de 8 bits, do menos para o
+// mais significativo. Cada passada é estável, então empates preservam a
+// ordem de entrada; passadas em que todas as chaves têm o mesmo dígito são
+// puladas. Acima de MINIMO_PARALELO elementos, cada passada divide o array
+// em faixas contíguas entre as threads (histograma e distribuição).
+class OrdenadorResultados {
+public:
+    static const int MINIMO_PARALELO = 1 << 18;
+
+private:
+    struct Item {
+        uint64_t chave;
+        Corrida* corrida;
+    };
+
+    int threads;
+
+    // Estatísticas da última ordenação
+    int passadas_executadas;
+    int passadas_puladas;
+
+public:
+    // Construtor
+    OrdenadorResultados(int threads);
+
+    // Operações principais
+    void ordenar(ResultadoCorrida* resultados, int tamanho);
+
+    // Getters
+    int getPassadasExecutadas() const;
+    int getPassadasPuladas() const;
+
+    // Mapeamento entre double e chave ordenável (bijetor)
+    static uint64_t chaveOrdenavel(double tempo);
+    static double tempoDaChave(uint64_t chave);
+
+private:
+    void ordenarSequencial(Item* itens, Item* auxiliar, int tamanho, Item** resultado);
+    void ordenarParalelo(Item* itens, Item* auxiliar, int tamanho, int num_threads, Item** resultado);
+};
+
+#endif
@@ -0,0 +1,25 @@
+#ifndef RELATORIOS_HPP
+#define RELATORIOS_HPP
+
+#include <chrono>
+
+class Arena;
+class Corrida;
+class EscritorSaida;
+class EventoPool;
+class GrafoCompatibilidade;
+
+double segundosDesde(std::chrono::steady_clock::time_point inicio);
+
+// Linha de uma corrida na saída (compatíveis com SaidaContinua::Impressora)
+void imprimirCorrida(EscritorSaida& escritor, Corrida* corrida, double tempo_conclusao);
+void imprimirCorridaIostream(EscritorSaida& escritor, Corrida* corrida, double tempo_conclusao);
+
+// Resumos e estatísticas em cerr
+void imprimirResumoInsercao(int demandas_inseridas, int demandas_individuais);
+void imprimirEstatisticasArena(const char* nome, const Arena& arena);
+void imprimirEstatisticasGrafo(const GrafoCompatibilidade& grafo, double segundos);
+void avisarGrafoDesabilitado(const GrafoCompatibilidade& grafo);
+void imprimirEstatisticasPool(const char* nome, const EventoPool& pool);
+
+#endif
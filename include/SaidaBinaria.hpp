@@ -0,0 +1,36 @@
+#ifndef SAIDA_BINARIA_HPP
+#define SAIDA_BINARIA_HPP
+
+#include "OrdenadorResultados.hpp"
+#include <cstdint>
+
+class EscritorSaida;
+
+// Grava os resultados no formato binário colunar (FormatoSaidaBinaria.hpp)
+// através do EscritorSaida. Uma primeira passada soma as paradas para
+// montar o cabeçalho; depois cada coluna é escrita percorrendo os
+// resultados, sem cópia intermediária.
+class SaidaBinaria {
+private:
+    EscritorSaida& escritor;
+    uint64_t bytes_gravados;
+
+public:
+    // Construtor
+    SaidaBinaria(EscritorSaida& escritor);
+
+    // Operações principais
+    void escrever(const ResultadoCorrida* resultados, int num_resultados);
+
+    // Getters
+    uint64_t getBytesGravados() const;
+
+private:
+    SaidaBinaria(const SaidaBinaria&);
+    SaidaBinaria& operator=(const SaidaBinaria&);
+
+    void escreverValor(const void* valor, uint64_t largura);
+    void completarAlinhamento();
+};
+
+#endif
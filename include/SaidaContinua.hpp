@@ -0,0 +1,58 @@
+#ifndef SAIDA_CONTINUA_HPP
+#define SAIDA_CONTINUA_HPP
+
+class Corrida;
+class EscritorSaida;
+
+// Saída em fluxo: cada corrida é escrita assim que o seu último evento sai
+// do escalonador, em vez de acumular todos os resultados e ordená-los no
+// fim. Os tempos de conclusão chegam em ordem não decrescente; só as
+// corridas com o mesmo tempo ficam retidas num pequeno buffer, liberado
+// quando chega um tempo maior e escrito pela ordem das corridas na junção,
+// a mesma dos empates na saída ordenada. Cada tempo escrito é descarregado
+// do EscritorSaida, para que quem acompanha a saída veja as corridas assim
+// que concluem (a saída ordenada descarrega só em blocos grandes).
+class SaidaContinua {
+public:
+    typedef void (*Impressora)(EscritorSaida& escritor, Corrida* corrida, double tempo_conclusao);
+
+private:
+    EscritorSaida& escritor;
+    Impressora imprimir;
+
+    // Buffer de empates
+    Corrida** corridas;
+    int* ordens;
+    int tamanho;
+    int capacidade;
+    double tempo;               // Tempo comum às corridas do buffer
+
+    // Estatísticas
+    long long total_escritas;
+    int maior_buffer;
+    long long fora_de_ordem;    // Tempos menores que o do buffer (não esperado)
+
+public:
+    // Construtor
+    SaidaContinua(EscritorSaida& escritor, Impressora imprimir);
+
+    // Destrutor
+    ~SaidaContinua();
+
+    // Operações principais
+    void registrar(double tempo_conclusao, int ordem, Corrida* corrida);
+    void finalizar();
+
+    // Estatísticas
+    long long getTotalEscritas() const;
+    int getMaiorBuffer() const;
+    long long getForaDeOrdem() const;
+
+private:
+    SaidaContinua(const SaidaContinua&);
+    SaidaContinua& operator=(const SaidaContinua&);
+
+    void esvaziar();
+};
+
+#endif
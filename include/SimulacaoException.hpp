@@ -0,0 +1,38 @@
+#ifndef SIMULACAO_EXCEPTION_HPP
+#define SIMULACAO_EXCEPTION_HPP
+
+#include <exception>
+#include <string>
+
+// Erros da execução, reportados pelo main com a mensagem de what()
+class SimulacaoException : public std::exception {
+protected:
+    std::string mensagem;
+public:
+    SimulacaoException(const std::string& msg) : mensagem(msg) {}
+    virtual const char* what() const throw() {
+        return mensagem.c_str();
+    }
+};
+
+class ParametroInvalidoException : public SimulacaoException {
+public:
+    ParametroInvalidoException(const std::string& msg) : SimulacaoException(msg) {}
+};
+
+class DemandaInvalidaException : public SimulacaoException {
+public:
+    DemandaInvalidaException(const std::string& msg) : SimulacaoException(msg) {}
+};
+
+class MemoriaInsuficienteException : public SimulacaoException {
+public:
+    MemoriaInsuficienteException(const std::string& msg) : SimulacaoException(msg) {}
+};
+
+class EstadoInvalidoException : public SimulacaoException {
+public:
+    EstadoInvalidoException(const std::string& msg) : SimulacaoException(msg) {}
+};
+
+#endif
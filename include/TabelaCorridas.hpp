@@ -0,0 +1,65 @@
+#ifndef TABELA_CORRIDAS_HPP
+#define TABELA_CORRIDAS_HPP
+
+#include "Corrida.hpp"
+#include "Escalonador.hpp"
+
+// Corridas de uma execução, referenciadas por índice e geração. O índice
+// de uma corrida é estável; substituí-la (inserção dinâmica) ou liberá-la
+// incrementa a geração, e referências antigas deixam de resolver. Cada
+// corrida tem no máximo um evento pendente no escalonador (a próxima
+// parada), registrado aqui pelo handle: a substituição redireciona esse
+// evento para a nova corrida, e uma partida ainda não ocorrida passa a
+// seguir o início da nova corrida, sem percorrer a fila. Liberar uma
+// corrida tira da fila o seu evento pendente.
+class TabelaCorridas {
+private:
+    Corrida** corridas;
+    unsigned int* geracoes;
+    HandleEvento* eventos_pendentes;
+    int tamanho;
+    int capacidade;
+    int* livres;                // Índices liberados, reaproveitados primeiro
+    int num_livres;
+
+    Escalonador* escalonador;   // Fila dos eventos pendentes (nullptr = nenhuma)
+
+    // Estatísticas
+    int substituicoes;
+    int eventos_redirecionados;
+    int partidas_reagendadas;
+    int eventos_cancelados;
+
+public:
+    // Construtor
+    TabelaCorridas(int capacidade_inicial, Escalonador* escalonador);
+
+    // Destrutor
+    ~TabelaCorridas();
+
+    // Operações principais
+    ReferenciaCorrida registrar(Corrida* corrida);
+    void substituir(int indice, Corrida* nova);
+    void liberar(int indice);
+    void vincularEvento(int indice, HandleEvento handle);
+    Corrida* obter(ReferenciaCorrida referencia) const;   // nullptr se antiga
+
+    // Getters
+    int getTamanho() const;
+    Corrida* getCorrida(int indice) const;
+    Corrida* const* getCorridas() const;                    // Por índice
+    ReferenciaCorrida getReferencia(int indice) const;
+    HandleEvento getEventoPendente(int indice) const;
+    int getSubstituicoes() const;
+    int getEventosRedirecionados() const;
+    int getPartidasReagendadas() const;
+    int getEventosCancelados() const;
+
+private:
+    TabelaCorridas(const TabelaCorridas&);
+    TabelaCorridas& operator=(const TabelaCorridas&);
+
+    void redimensionar();
+};
+
+#endif
@@ -0,0 +1,12 @@
+#ifndef VARREDURA_HPP
+#define VARREDURA_HPP
+
+#include "OpcoesExecucao.hpp"
+
+// Varredura de parâmetros (--varredura=arquivo): lê cada conjunto de
+// demandas uma vez, executa as fases 1 e 2 e o avanço direto de todas as
+// configurações do arquivo num conjunto de threads e escreve em cout as
+// métricas dos scripts run_*_tests.sh, uma linha CSV por configuração
+void executarVarredura(const char* caminho_configuracoes, const OpcoesExecucao& opcoes);
+
+#endif
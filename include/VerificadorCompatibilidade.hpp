@@ -0,0 +1,70 @@
+#ifndef VERIFICADOR_COMPATIBILIDADE_HPP
+#define VERIFICADOR_COMPATIBILIDADE_HPP
+
+#include <cstdint>
+#include "Demanda.hpp"
+
+enum ConjuntoInstrucoes {
+    ISA_AUTOMATICO,
+    ISA_ESCALAR,
+    ISA_SSE2,
+    ISA_AVX2
+};
+
+// Núcleo vetorizado dos critérios 2 e 3 de compartilhamento (distância entre
+// origens <= alfa e entre destinos <= beta). Compara um ponto com até 64
+// pontos de uma vez usando distâncias ao quadrado e devolve uma máscara de
+// bits dos compatíveis. O limite ao quadrado é o maior double cuja raiz é
+// <= alfa (ou beta), o que torna a comparação equivalente bit a bit a
+// sqrt(dx * dx + dy * dy) > alfa, inclusive para NaN e infinitos.
+class VerificadorCompatibilidade {
+public:
+    // Máximo de pontos comparados por chamada (bits da máscara)
+    static const int TAMANHO_LOTE = 64;
+
+    typedef uint64_t (*Nucleo)(const double* xs, const double* ys, int quantidade,
+                               double px, double py, double limite_quadrado);
+
+private:
+    const DemandaStore* demandas;
+    double limite_origem;           // Maior s com sqrt(s) <= alfa
+    double limite_destino;          // Maior s com sqrt(s) <= beta
+    ConjuntoInstrucoes isa;
+    Nucleo nucleo;
+
+    // Coordenadas dos membros do grupo copiadas para posições contíguas
+    double buffer_x[TAMANHO_LOTE];
+    double buffer_y[TAMANHO_LOTE];
+
+public:
+    // Construtor
+    VerificadorCompatibilidade(const DemandaStore* demandas, double alfa, double beta,
+                               ConjuntoInstrucoes isa = ISA_AUTOMATICO);
+
+    // Operações principais
+
+    // true se a demanda nova for compatível com todos os membros do grupo
+    bool verificarGrupo(const int* membros, int num_membros, int nova);
+
+    // Máscara (bit k = demanda inicio + k) das demandas do bloco contíguo
+    // [inicio, inicio + quantidade) compatíveis com a demanda base
+    uint64_t compararBloco(int base, int inicio, int quantidade) const;
+
+    // Getters
+    ConjuntoInstrucoes getConjuntoInstrucoes() const;
+    static const char* nomeConjuntoInstrucoes(ConjuntoInstrucoes isa);
+
+    // Núcleos disponíveis (expostos para comparação entre implementações)
+    static ConjuntoInstrucoes detectarConjuntoInstrucoes();
+    static Nucleo obterNucleo(ConjuntoInstrucoes isa);
+    static double calcularLimiteQuadrado(double raio);
+
+private:
+    VerificadorCompatibilidade(const VerificadorCompatibilidade&);
+    VerificadorCompatibilidade& operator=(const VerificadorCompatibilidade&);
+
+    uint64_t compararMembros(const double* coluna_x, const double* coluna_y, const int* membros,
+                             int quantidade, int nova, double limite);
+};
+
+#endif
@@ -74,7 +74,7 @@ for input_file in $(ls -1 "$INPUT_DIR"/input_alpha_*.txt | sort -V); do
     fi
     
     # Roda o programa
-    $BIN < "$input_file" > "$output_file" 2>&1
+    $BIN < "$input_file" > "$output_file" 2>/dev/null
     
     # Verifica se executou com sucesso
     if [ $? -eq 0 ]; then
@@ -82,9 +82,10 @@ for input_file in $(ls -1 "$INPUT_DIR"/input_alpha_*.txt | sort -V); do
         total_demands=$(head -n 7 "$input_file" | tail -n 1)
         alpha=$(head -n 4 "$input_file" | tail -n 1)
         
-        # Conta corridas individuais (2 paradas) e compartilhadas (>2 paradas)
-        individual_rides=$(awk '{if($3==2) print}' "$output_file" | wc -l)
-        shared_rides=$(awk '{if($3>2) print}' "$output_file" | wc -l)
+        # Conta corridas individuais (2 paradas) e compartilhadas (>2 paradas);
+        # a coluna 3 é a eficiência e a 4 o número de paradas
+        individual_rides=$(awk '{if($4==2) print}' "$output_file" | wc -l)
+        shared_rides=$(awk '{if($4>2) print}' "$output_file" | wc -l)
         total_rides=$((individual_rides + shared_rides))
         
         # Calcula % de corridas compartilhadas usando AWK (mais portável que bc)
@@ -96,7 +97,7 @@ for input_file in $(ls -1 "$INPUT_DIR"/input_alpha_*.txt | sort -V); do
         
         # Calcula média de passageiros por corrida compartilhada
         if [ "$shared_rides" -gt 0 ]; then
-            avg_passengers=$(awk '{if($3>2) {sum+=$3/2; count++}} END {if(count>0) printf "%.2f", sum/count; else print "0.00"}' "$output_file")
+            avg_passengers=$(awk '{if($4>2) {sum+=$4/2; count++}} END {if(count>0) printf "%.2f", sum/count; else print "0.00"}' "$output_file")
         else
             avg_passengers="0.00"
         fi
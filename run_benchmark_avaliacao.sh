@@ -0,0 +1,37 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Benchmark da fase 1: avaliação incremental das candidatas
+# vs reconstrução de cada corrida candidata, variando eta
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+BENCH_DIR="./benchmark"
+NUM_DEMANDS=20000
+ETAS="2 4 8 16 32"
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+mkdir -p "$BENCH_DIR"
+
+# Cenário denso: muitas demandas por segundo em um espaço pequeno, com
+# alfa/beta generosos e lambda baixo para que os grupos cheguem a eta
+base_file="$BENCH_DIR/input_avaliacao_base.txt"
+python3 generate_benchmark_input.py "$NUM_DEMANDS" "$base_file" 20 2000 > /dev/null
+
+phase1_time() {
+    $BIN "$@" --tempos 2>&1 >/dev/null | awk '/Tempo de construcao/ {print $6}'
+}
+
+echo "eta,reconstrucao_s,incremental_s"
+for eta in $ETAS; do
+    input_file="$BENCH_DIR/input_avaliacao_eta_$eta.txt"
+    awk -v eta="$eta" 'NR==1 {print eta; next} NR==4 || NR==5 {print "2000.0"; next} NR==6 {print "0.1"; next} {print}' \
+        "$base_file" > "$input_file"
+
+    reconstrucao=$(phase1_time --avaliacao=reconstrucao < "$input_file")
+    incremental=$(phase1_time < "$input_file")
+    echo "$eta,$reconstrucao,$incremental"
+done
@@ -0,0 +1,78 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Benchmark da simulação: heap (heapifyUp/heapifyDown) vs
+# fila de calendário vs avanço direto, nas entradas exp* e
+# numa entrada sintética grande
+# Uso: ./run_benchmark_escalonador.sh [num_demandas_sintetico]
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+BENCH_DIR="./benchmark"
+NUM_DEMANDS=${1:-10000000}
+MODOS="heap calendario direta"
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+mkdir -p "$BENCH_DIR"
+
+# Argumentos de cada modo de simulação
+args_modo() {
+    case "$1" in
+        direta) echo "--simulacao=direta" ;;
+        *) echo "--simulacao=eventos --fila=$1" ;;
+    esac
+}
+
+# "Tempo de simulacao: <s> s (<fila>, <n> eventos|corridas)" -> "<s> <n>"
+parse_simulacao() {
+    awk '/Tempo de simulacao/ {gsub(/\(/, "", $0); print $4, $(NF-1)}' "$1"
+}
+
+echo "entrada,modo,eventos_ou_corridas,simulacao_s,milhoes_por_s,saida_identica"
+
+# Entradas dos experimentos: tempos e eventos somados por modo
+for modo in $MODOS; do
+    total_s=0
+    total_eventos=0
+    identicas="sim"
+    for input_file in exp*/inputs/*.txt; do
+        $BIN --tempos $(args_modo "$modo") < "$input_file" \
+            > "$BENCH_DIR/saida_escalonador.txt" 2> "$BENCH_DIR/log_escalonador.txt"
+        read -r segundos eventos <<< "$(parse_simulacao "$BENCH_DIR/log_escalonador.txt")"
+        total_s=$(awk -v a="$total_s" -v b="$segundos" 'BEGIN {print a + b}')
+        total_eventos=$((total_eventos + eventos))
+
+        $BIN --simulacao=eventos < "$input_file" > "$BENCH_DIR/saida_escalonador_heap.txt" 2>/dev/null
+        if ! cmp -s "$BENCH_DIR/saida_escalonador.txt" "$BENCH_DIR/saida_escalonador_heap.txt"; then
+            identicas="nao"
+        fi
+    done
+    taxa=$(awk -v n="$total_eventos" -v s="$total_s" 'BEGIN {if (s > 0) printf "%.3f", n / s / 1e6}')
+    echo "exp*,$modo,$total_eventos,$total_s,$taxa,$identicas"
+done
+
+# Entrada sintética: só a simulação é medida; o processo é encerrado assim
+# que reporta o tempo dela, sem esperar a ordenação e a escrita da saída
+input_file="$BENCH_DIR/input_escalonador_$NUM_DEMANDS.txt"
+if [ ! -f "$input_file" ]; then
+    python3 generate_benchmark_input.py "$NUM_DEMANDS" "$input_file" 10 10000 > /dev/null
+fi
+
+for modo in $MODOS; do
+    log_file="$BENCH_DIR/log_escalonador_$modo.txt"
+    : > "$log_file"
+    $BIN --tempos $(args_modo "$modo") < "$input_file" > /dev/null 2> "$log_file" &
+    pid=$!
+    while kill -0 "$pid" 2> /dev/null && ! grep -q "Tempo de simulacao" "$log_file"; do
+        sleep 1
+    done
+    kill "$pid" 2> /dev/null
+    wait "$pid" 2> /dev/null
+
+    read -r segundos eventos <<< "$(parse_simulacao "$log_file")"
+    taxa=$(awk -v n="$eventos" -v s="$segundos" 'BEGIN {if (s > 0) printf "%.3f", n / s / 1e6}')
+    echo "sintetico_$NUM_DEMANDS,$modo,$eventos,$segundos,$taxa,"
+done
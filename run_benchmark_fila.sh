@@ -0,0 +1,34 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Microbenchmark do escalonador: heap binário de ponteiros
+# vs heap d-ário com chaves inline vs fila de calendário,
+# de 10^4 a 10^N eventos. Cada execução confere antes a fila
+# (atualizações, remoções e handles) contra uma referência;
+# o script termina com erro se alguma divergir
+# Uso: ./run_benchmark_fila.sh [expoente_maximo] [aridade]
+# ---------------------------------------------------------
+
+MAX_EXP=${1:-8}
+ARIDADE=${2:-4}
+BIN="./bin/benchmark_fila.out"
+
+# O benchmark é compilado com a aridade pedida, independentemente da fila
+# usada pelo executável principal
+rm -f "$BIN"
+make benchmark_fila ARIDADE="$ARIDADE" > /dev/null || exit 1
+
+echo "fila,aridade,eventos,carga_s,carga_lote_s,hold_s,mops_hold,checksum,operacoes_conferidas,divergencias"
+falhas=0
+for exp in $(seq 4 "$MAX_EXP"); do
+    n=$(awk -v e="$exp" 'BEGIN {printf "%d", 10^e}')
+    # Uma fila por processo: em 10^8 eventos só uma cabe na memória por vez
+    for fila in binario daria calendario; do
+        $BIN "$n" "$fila"
+        status=$?
+        if [ "$status" -eq 1 ]; then
+            echo "$fila,,$n,falhou,,,,,,"
+        fi
+        [ "$status" -eq 0 ] || falhas=$((falhas + 1))
+    done
+done
+[ "$falhas" -eq 0 ]
@@ -0,0 +1,41 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Benchmark da fase 1: grade espacial vs varredura linear
+# da janela temporal, variando a densidade de demandas
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+BENCH_DIR="./benchmark"
+NUM_DEMANDS=20000
+RATES="1 10 50 200 1000"
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+mkdir -p "$BENCH_DIR"
+
+phase1_time() {
+    $BIN "$@" --tempos 2>&1 >/dev/null | awk '/Tempo de construcao/ {print $6}'
+}
+
+# Quanto maior a taxa, mais demandas caem na janela delta de cada uma;
+# alfa/beta ficam pequenos diante do espaço, como em um centro urbano
+echo "demandas_por_segundo,linear_s,grade_s,saidas_iguais"
+for rate in $RATES; do
+    input_file="$BENCH_DIR/input_grade_$rate.txt"
+    python3 generate_benchmark_input.py "$NUM_DEMANDS" "$input_file" "$rate" 20000 > /dev/null
+
+    linear=$(phase1_time --indice=linear < "$input_file")
+    grade=$(phase1_time --indice=grade < "$input_file")
+
+    $BIN --indice=linear < "$input_file" > "$BENCH_DIR/saida_linear.txt" 2>/dev/null
+    $BIN --indice=grade < "$input_file" > "$BENCH_DIR/saida_grade.txt" 2>/dev/null
+    if cmp -s "$BENCH_DIR/saida_linear.txt" "$BENCH_DIR/saida_grade.txt"; then
+        iguais="sim"
+    else
+        iguais="nao"
+    fi
+    echo "$rate,$linear,$grade,$iguais"
+done
@@ -0,0 +1,51 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Benchmark da fase 2 (inserção dinâmica): tempo variando o
+# número de threads de 1 até o número de núcleos
+# Uso: ./run_benchmark_insercao.sh [max_threads]
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+BENCH_DIR="./benchmark"
+NUM_DEMANDS=20000
+MAX_THREADS=${1:-$(nproc)}
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+mkdir -p "$BENCH_DIR"
+
+# Potências de 2 até o máximo, e o próprio máximo
+THREADS=""
+for ((t = 1; t < MAX_THREADS; t *= 2)); do
+    THREADS="$THREADS $t"
+done
+THREADS="$THREADS $MAX_THREADS"
+
+# Dois cenários: espaço amplo (poucos conflitos entre demandas de um lote)
+# e centro denso (muitas corridas alcançáveis, muitas reavaliações)
+python3 generate_benchmark_input.py "$NUM_DEMANDS" "$BENCH_DIR/input_insercao_amplo.txt" 20 30000 > /dev/null
+python3 generate_benchmark_input.py "$NUM_DEMANDS" "$BENCH_DIR/input_insercao_denso_base.txt" 20 5000 > /dev/null
+awk 'NR==1 {print 8; next} NR==6 {print "0.2"; next} {print}' \
+    "$BENCH_DIR/input_insercao_denso_base.txt" > "$BENCH_DIR/input_insercao_denso.txt"
+
+echo "cenario,threads,fase2_s,reavaliacoes,saida_identica"
+for cenario in amplo denso; do
+    input_file="$BENCH_DIR/input_insercao_$cenario.txt"
+    $BIN < "$input_file" > "$BENCH_DIR/saida_insercao_1.txt" 2>/dev/null
+
+    for threads in $THREADS; do
+        $BIN --threads="$threads" --tempos < "$input_file" \
+            > "$BENCH_DIR/saida_insercao.txt" 2> "$BENCH_DIR/log_insercao.txt"
+        tempo=$(awk '/Tempo de insercao dinamica/ {print $5}' "$BENCH_DIR/log_insercao.txt")
+        reavaliacoes=$(awk '/^Fase 2:/ {print $5}' "$BENCH_DIR/log_insercao.txt")
+        if cmp -s "$BENCH_DIR/saida_insercao_1.txt" "$BENCH_DIR/saida_insercao.txt"; then
+            identica="sim"
+        else
+            identica="nao"
+        fi
+        echo "$cenario,$threads,$tempo,$reavaliacoes,$identica"
+    done
+done
@@ -0,0 +1,32 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Benchmark da leitura da entrada: std::cin vs LeitorEntrada
+# (arquivo mapeado em memória e leitura em blocos via pipe)
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+BENCH_DIR="./benchmark"
+SIZES="100000 1000000 5000000"
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+mkdir -p "$BENCH_DIR"
+
+echo "demandas,modo,segundos"
+for n in $SIZES; do
+    input_file="$BENCH_DIR/input_benchmark_$n.txt"
+    if [ ! -f "$input_file" ]; then
+        python3 generate_benchmark_input.py "$n" "$input_file" > /dev/null
+    fi
+
+    stream=$($BIN --leitura=stream --somente-leitura --tempos < "$input_file" 2>&1 | awk '/Tempo de leitura/ {print $4}')
+    mmap=$($BIN --somente-leitura --tempos < "$input_file" 2>&1 | awk '/Tempo de leitura/ {print $4}')
+    pipe=$(cat "$input_file" | $BIN --somente-leitura --tempos 2>&1 | awk '/Tempo de leitura/ {print $4}')
+
+    echo "$n,stream,$stream"
+    echo "$n,mmap,$mmap"
+    echo "$n,blocos,$pipe"
+done
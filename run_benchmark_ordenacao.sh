@@ -0,0 +1,20 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Microbenchmark da ordenação dos resultados: quicksort
+# recursivo antigo vs radix sort LSD (1 e N threads) em
+# entradas ordenadas, invertidas e aleatórias
+# Uso: ./run_benchmark_ordenacao.sh [threads]
+# ---------------------------------------------------------
+
+THREADS=${1:-$(nproc)}
+BIN="./bin/benchmark_ordenacao.out"
+TAMANHOS="10000 100000 1000000 10000000"
+
+make benchmark_ordenacao > /dev/null || exit 1
+
+echo "entrada,n,quicksort_s,radix_1_s,radix_n_s,threads,estavel"
+for n in $TAMANHOS; do
+    for entrada in ordenada invertida aleatoria; do
+        $BIN "$n" "$entrada" "$THREADS"
+    done
+done
@@ -0,0 +1,19 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Microbenchmark da alocação de eventos: new/delete por
+# parada vs EventoPool do escalonador
+# Uso: ./run_benchmark_pool.sh [paradas_por_corrida]
+# ---------------------------------------------------------
+
+PARADAS=${1:-8}
+BIN="./bin/benchmark_pool.out"
+CORRIDAS="10000 100000 1000000"
+
+make benchmark_pool > /dev/null || exit 1
+
+echo "modo,corridas,eventos,chamadas_new,chamadas_delete,pico_vivos,segundos"
+for corridas in $CORRIDAS; do
+    for modo in new pool; do
+        $BIN "$corridas" "$PARADAS" "$modo"
+    done
+done
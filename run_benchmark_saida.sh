@@ -0,0 +1,17 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Microbenchmark da escrita da saída: operator<< com endl por
+# linha vs EscritorSaida (formatação própria e buffer grande).
+# Também confere o formatador contra o iostream.
+# Uso: ./run_benchmark_saida.sh
+# ---------------------------------------------------------
+
+BIN="./bin/benchmark_saida.out"
+LINHAS="10000 100000 1000000 5000000"
+
+make benchmark_saida > /dev/null || exit 1
+
+echo "linhas,valores_conferidos,divergencias,iostream_s,escritor_s,mb_escritor_s"
+for n in $LINHAS; do
+    $BIN "$n"
+done
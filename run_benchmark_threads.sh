@@ -0,0 +1,42 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Benchmark da fase 1 paralela: tempo de construção das
+# corridas variando o número de threads
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+BENCH_DIR="./benchmark"
+NUM_DEMANDS=30000
+THREADS="1 2 4 8 16 32"
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+mkdir -p "$BENCH_DIR"
+
+# Demandas em rajadas de 500 separadas por pausas de 60 s (> delta), como
+# nos picos de um dia de operação; cada pausa é um ponto de corte possível
+base_file="$BENCH_DIR/input_threads_base.txt"
+input_file="$BENCH_DIR/input_threads.txt"
+python3 generate_benchmark_input.py "$NUM_DEMANDS" "$base_file" 20 5000 > /dev/null
+awk 'NR<=7 {print; next} {$2 = sprintf("%.2f", $2 + int($1 / 500) * 60); print}' "$base_file" > "$input_file"
+
+phase1_time() {
+    $BIN "$@" --tempos 2>&1 >/dev/null | awk '/Tempo de construcao/ {print $6}'
+}
+
+$BIN < "$input_file" > "$BENCH_DIR/saida_threads_1.txt" 2>/dev/null
+
+echo "threads,fase1_s,saida_identica"
+for threads in $THREADS; do
+    tempo=$(phase1_time --threads="$threads" < "$input_file")
+    $BIN --threads="$threads" < "$input_file" > "$BENCH_DIR/saida_threads.txt" 2>/dev/null
+    if cmp -s "$BENCH_DIR/saida_threads_1.txt" "$BENCH_DIR/saida_threads.txt"; then
+        identica="sim"
+    else
+        identica="nao"
+    fi
+    echo "$threads,$tempo,$identica"
+done
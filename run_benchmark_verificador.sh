@@ -0,0 +1,17 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Microbenchmark dos núcleos de distância da fase 1 (escalar,
+# SSE2 e AVX2). Também confere as máscaras dos núcleos
+# vetorizados contra o núcleo escalar e o critério com sqrt.
+# Uso: ./run_benchmark_verificador.sh
+# ---------------------------------------------------------
+
+BIN="./bin/benchmark_verificador.out"
+BLOCOS="100000 1000000 10000000"
+
+make benchmark_verificador > /dev/null || exit 1
+
+echo "blocos,mascaras_conferidas,divergencias,escalar_s,sse2_s,avx2_s,isa_sse2,isa_avx2"
+for n in $BLOCOS; do
+    $BIN "$n"
+done
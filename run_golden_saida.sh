@@ -0,0 +1,62 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Teste de saída contra as saídas de referência do repositório
+# (output_*.txt e exp*/outputs), com o EscritorSaida, com a
+# formatação por iostream e com a saída binária convertida de
+# volta para texto (conversor_saida). As referências geradas antes da
+# coluna de eficiência são comparadas sem essa coluna.
+# Uso: ./run_golden_saida.sh [opções extras do tp2]
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+CONVERSOR="./bin/conversor_saida.out"
+TMP_SAIDA=$(mktemp)
+trap 'rm -f "$TMP_SAIDA"' EXIT
+
+make all conversor_saida > /dev/null || exit 1
+
+# Remove o 3º campo (eficiência) quando a referência não o tem
+ajustar_colunas() {
+    if [ "$1" = "1" ]; then
+        cat
+    else
+        awk '{ $3 = ""; sub(/  /, " "); print }'
+    fi
+}
+
+comparar() {
+    local entrada="$1" esperado="$2"
+    [ -f "$esperado" ] || return 0
+    local com_eficiencia
+    com_eficiencia=$(head -n 1 "$esperado" | awk '{ print (NF == 4 + 2 * $4) ? 1 : 0 }')
+
+    for escrita in buffer iostream binario; do
+        total=$((total + 1))
+        if [ "$escrita" = "binario" ]; then
+            "$BIN" --formato=binario "${@:3}" < "$entrada" 2> /dev/null | "$CONVERSOR"
+        else
+            "$BIN" --escrita=$escrita "${@:3}" < "$entrada" 2> /dev/null
+        fi | ajustar_colunas "$com_eficiencia" > "$TMP_SAIDA"
+        if cmp -s "$TMP_SAIDA" "$esperado"; then
+            iguais=$((iguais + 1))
+        else
+            echo "DIFERENTE ($escrita): $entrada"
+        fi
+    done
+}
+
+total=0
+iguais=0
+for entrada in input_*.txt; do
+    comparar "$entrada" "${entrada/input_/output_}" "$@"
+done
+for pasta in exp*/; do
+    for entrada in "$pasta"inputs/input_*.txt; do
+        [ -f "$entrada" ] || continue
+        nome=$(basename "$entrada")
+        comparar "$entrada" "${pasta}outputs/${nome/input_/output_}" "$@"
+    done
+done
+
+echo "$iguais de $total saidas iguais as referencias"
+[ "$iguais" -eq "$total" ]
@@ -0,0 +1,68 @@
+#!/bin/bash
+# ---------------------------------------------------------
+# Executa um experimento inteiro (exp1_*/exp2_*) num único processo com
+# --varredura: cada input é lido uma vez e as configurações rodam em
+# paralelo. Gera o mesmo CSV de métricas dos scripts run_*_tests.sh, sem
+# gravar as saídas de cada input.
+#
+# Uso: ./run_varredura.sh <parametro> [arquivo_metricas]
+#      parametro: eta, delta, alpha, beta ou lambda
+# ---------------------------------------------------------
+
+BIN="./bin/tp2.out"
+PARAM="$1"
+
+case "$PARAM" in
+    delta)  EXP_DIR="./exp1_delta";  LINHA_PARAM=3 ;;
+    alpha)  EXP_DIR="./exp1_alpha";  LINHA_PARAM=4 ;;
+    beta)   EXP_DIR="./exp1_beta";   LINHA_PARAM=5 ;;
+    eta)    EXP_DIR="./exp1_eta";    LINHA_PARAM=1 ;;
+    lambda) EXP_DIR="./exp2_lambda"; LINHA_PARAM=6 ;;
+    *)
+        echo "Uso: $0 <eta|delta|alpha|beta|lambda> [arquivo_metricas]"
+        exit 1
+        ;;
+esac
+
+INPUT_DIR="$EXP_DIR/inputs"
+METRICS_FILE="${2:-$EXP_DIR/metrics_$PARAM.csv}"
+THREADS=$(nproc 2>/dev/null || echo 1)
+
+if [ ! -f "$BIN" ]; then
+    echo "❌ Executável não encontrado! Rode 'make' antes."
+    exit 1
+fi
+
+inputs=$(ls -1 "$INPUT_DIR"/input_${PARAM}_*.txt 2>/dev/null | sort -V)
+if [ -z "$inputs" ]; then
+    echo "⚠️  Nenhum arquivo de input encontrado em $INPUT_DIR"
+    exit 1
+fi
+
+# Uma configuração por input, com todos os parâmetros do próprio arquivo
+CONFIG=$(mktemp)
+RESULTADO=$(mktemp)
+trap 'rm -f "$CONFIG" "$RESULTADO"' EXIT
+
+for input_file in $inputs; do
+    echo "- - - - - - $input_file" >> "$CONFIG"
+done
+
+if ! $BIN --varredura="$CONFIG" --threads="$THREADS" > "$RESULTADO"; then
+    echo "❌ Erro ao executar a varredura"
+    exit 1
+fi
+
+# Junta as linhas da varredura (na ordem dos inputs) com o número do teste
+# e o valor do parâmetro como escrito no cabeçalho de cada input
+echo "test_num,$PARAM,total_demands,individual_rides,shared_rides,pct_shared,avg_passengers_shared,avg_efficiency" > "$METRICS_FILE"
+linha=2
+for input_file in $inputs; do
+    test_num=$(basename "$input_file" | sed "s/input_${PARAM}_\([0-9]*\).txt/\1/")
+    valor=$(head -n "$LINHA_PARAM" "$input_file" | tail -n 1)
+    metricas=$(sed -n "${linha}p" "$RESULTADO" | cut -d, -f8-)
+    echo "$test_num,$valor,$metricas" >> "$METRICS_FILE"
+    linha=$((linha + 1))
+done
+
+echo "📊 $((linha - 2)) configuração(ões) em $THREADS thread(s): $METRICS_FILE"
@@ -0,0 +1,237 @@
+#include "Agrupamento.hpp"
+#include "ConstrucaoCorridas.hpp"
+#include <cstdint>
+
+// Construtor
+TrabalhadorFase1::TrabalhadorFase1(DemandaStore* demandas, const ParametrosFase1& parametros, ConjuntoInstrucoes isa,
+                                   Arena* arena, Arena* rascunho)
+    : arena(arena), rascunho(rascunho), avaliador(demandas, parametros.eta),
+      verificador(demandas, parametros.alfa, parametros.beta, isa), candidatas(nullptr), capacidade_candidatas(0) {
+    reservarCandidatas(demandas->getTamanho());
+}
+
+// Destrutor
+TrabalhadorFase1::~TrabalhadorFase1() {
+    delete[] this->candidatas;
+}
+
+// Operações principais
+
+// Garante espaço para quantidade candidatas (no modo online o store
+// cresce depois da construção)
+int* TrabalhadorFase1::reservarCandidatas(int quantidade) {
+    if (quantidade > this->capacidade_candidatas || this->candidatas == nullptr) {
+        int nova_capacidade = 2 * this->capacidade_candidatas;
+        if (quantidade > nova_capacidade) {
+            nova_capacidade = quantidade;
+        }
+        delete[] this->candidatas;
+        this->capacidade_candidatas = nova_capacidade > 0 ? nova_capacidade : 1;
+        this->candidatas = new int[this->capacidade_candidatas];
+    }
+    return this->candidatas;
+}
+
+// Divide [0, n) em lotes que nunca compartilham corridas entre si: com os
+// tempos em ordem, um intervalo >= delta entre demandas consecutivas encerra
+// a janela de todas as anteriores. Cada lote tem ao menos tamanho_minimo
+// demandas (exceto o último). Retorna o número de lotes; limites[k] e
+// limites[k + 1] delimitam o lote k
+int dividirEmLotes(const double* tempos, int n, double delta, int tamanho_minimo, int* limites) {
+    int num_lotes = 0;
+    limites[0] = 0;
+    
+    for (int k = 1; k < n; k++) {
+        if (!(tempos[k] >= tempos[k - 1])) {
+            // Fora de ordem: as janelas não são intervalos de índices
+            limites[1] = n;
+            return 1;
+        }
+    }
+    
+    for (int k = 1; k < n; k++) {
+        if (k - limites[num_lotes] >= tamanho_minimo && tempos[k] - tempos[k - 1] >= delta) {
+            num_lotes++;
+            limites[num_lotes] = k;
+        }
+    }
+    num_lotes++;
+    limites[num_lotes] = n;
+    return num_lotes;
+}
+
+// Escolhe os membros da corrida de i pelo grafo: as candidatas são as
+// arestas de i (em ordem de índice, como na varredura linear) e as
+// distâncias até os demais membros vêm das arestas deles, sem raízes
+static void escolherMembrosGrafo(DemandaStore& demandas, const ParametrosFase1& parametros,
+                                 TrabalhadorFase1& trabalhador, int i) {
+    const GrafoCompatibilidade& grafo = *parametros.grafo;
+    const int* vizinhos = grafo.getVizinhos();
+    const double* distancias_origem = grafo.getDistanciasOrigem();
+    const double* distancias_destino = grafo.getDistanciasDestino();
+    const double* rotas = grafo.getRotas();
+    const double* tempos = demandas.getTempos();
+    const unsigned char* estados = demandas.getEstados();
+    AvaliadorCorrida& avaliador = trabalhador.avaliador;
+    double tempo_base = tempos[i];
+    
+    // Nenhuma aresta de i dentro de alfa/beta: a corrida fica individual
+    if (!grafo.temCandidatas(i, parametros.alfa, parametros.beta)) {
+        return;
+    }
+    
+    for (long long a = grafo.getInicio(i); a < grafo.getFim(i) && avaliador.getNumMembros() < parametros.eta; a++) {
+        int j = vizinhos[a];
+        if (estados[j] != DEMANDADA) {
+            continue;
+        }
+        
+        // Critério 1: Intervalo de tempo (as arestas seguem a ordem dos tempos)
+        if (tempos[j] - tempo_base >= parametros.delta) {
+            break;
+        }
+        
+        // Critério 2 e 3: com a base e com cada um dos demais membros
+        if (distancias_origem[a] > parametros.alfa || distancias_destino[a] > parametros.beta) {
+            continue;
+        }
+        const int* membros = avaliador.getMembros();
+        long long aresta_ultimo = a;
+        bool compativel = true;
+        for (int k = 1; k < avaliador.getNumMembros() && compativel; k++) {
+            aresta_ultimo = grafo.buscarAresta(membros[k], j);
+            compativel = aresta_ultimo >= 0 && !(distancias_origem[aresta_ultimo] > parametros.alfa) &&
+                         !(distancias_destino[aresta_ultimo] > parametros.beta);
+        }
+        if (!compativel) {
+            continue;
+        }
+        
+        double eficiencia;
+        if (parametros.avaliacao_reconstrucao) {
+            eficiencia = avaliarPorReconstrucao(demandas, avaliador.getMembros(), avaliador.getNumMembros(),
+                                                j, parametros.gama, tempo_base, *trabalhador.rascunho);
+        } else {
+            avaliador.informarCandidato(j, distancias_origem[aresta_ultimo], distancias_destino[aresta_ultimo],
+                                        rotas[a]);
+            eficiencia = avaliador.calcularEficienciaComAdicao(j);
+        }
+        
+        // Critério 4: Eficiência
+        if (eficiencia < parametros.lambda) {
+            break;
+        }
+        
+        avaliador.adicionar(j);
+    }
+}
+
+// Forma a corrida cuja primeira demanda é i (ainda DEMANDADA), com
+// candidatas entre as seguintes até fim, e a constrói na arena do
+// trabalhador. Cada demanda agrupada guarda provisoriamente i como índice
+// de corrida (a numeração final é feita na junção)
+Corrida* agruparBase(DemandaStore& demandas, const ParametrosFase1& parametros, TrabalhadorFase1& trabalhador,
+                     int i, int fim) {
+    const double* tempos = demandas.getTempos();
+    const unsigned char* estados = demandas.getEstados();
+    AvaliadorCorrida& avaliador = trabalhador.avaliador;
+    VerificadorCompatibilidade& verificador = trabalhador.verificador;
+    bool usa_grade = parametros.grade != nullptr;
+    int* candidatas = usa_grade ? trabalhador.reservarCandidatas(demandas.getTamanho()) : nullptr;
+    
+    // Conjunto de demandas (índices no store) para a corrida atual
+    avaliador.iniciar(i);
+    double tempo_base = tempos[i];
+    
+    if (parametros.grafo != nullptr) {
+        escolherMembrosGrafo(demandas, parametros, trabalhador, i);
+    } else {
+        // Candidatas em ordem crescente: com a grade, só as da janela
+        // temporal em células vizinhas; sem ela, todas as seguintes do lote
+        int num_candidatas = usa_grade ? parametros.grade->buscarCandidatas(i, candidatas) : fim - i - 1;
+        
+        // Sem a grade, as seguintes são comparadas com a base em blocos
+        // contíguos de TAMANHO_LOTE; a máscara descarta as incompatíveis
+        int inicio_bloco = -1;
+        uint64_t mascara_bloco = 0;
+        
+        // Tentar combinar com outras demandas
+        for (int c = 0; c < num_candidatas && avaliador.getNumMembros() < parametros.eta; c++) {
+            int j = usa_grade ? candidatas[c] : i + 1 + c;
+            if (estados[j] != DEMANDADA) {
+                continue;
+            }
+            
+            // Critério 1: Intervalo de tempo
+            double diff_tempo = tempos[j] - tempo_base;
+            if (diff_tempo >= parametros.delta) {
+                break; // Não há mais candidatos dentro do intervalo
+            }
+            
+            // Critério 2 e 3: Distância entre origens e destinos
+            if (!usa_grade) {
+                if (inicio_bloco < 0 || j - inicio_bloco >= VerificadorCompatibilidade::TAMANHO_LOTE) {
+                    inicio_bloco = j;
+                    mascara_bloco = verificador.compararBloco(i, j, fim - j);
+                }
+                if (((mascara_bloco >> (j - inicio_bloco)) & 1) == 0) {
+                    continue;
+                }
+            }
+            if (!verificador.verificarGrupo(avaliador.getMembros(), avaliador.getNumMembros(), j)) {
+                continue;
+            }
+            
+            // Eficiência do grupo com a demanda adicional
+            double eficiencia;
+            if (parametros.avaliacao_reconstrucao) {
+                eficiencia = avaliarPorReconstrucao(demandas, avaliador.getMembros(), avaliador.getNumMembros(),
+                                                    j, parametros.gama, tempo_base, *trabalhador.rascunho);
+            } else {
+                eficiencia = avaliador.calcularEficienciaComAdicao(j);
+            }
+            
+            // Critério 4: Eficiência
+            if (eficiencia < parametros.lambda) {
+                break;
+            }
+            
+            avaliador.adicionar(j);
+        }
+    }
+    
+    // Construir corrida final (única materialização do grupo)
+    const int* demandas_corrida = avaliador.getMembros();
+    int num_demandas_corrida = avaliador.getNumMembros();
+    Corrida* corrida_final = construirCorrida(demandas, demandas_corrida, num_demandas_corrida, parametros.gama, tempo_base, *trabalhador.arena);
+    double eficiencia_final = calcularEficienciaCorrida(demandas, demandas_corrida, num_demandas_corrida, corrida_final->getDistanciaTotal());
+    corrida_final->setEficiencia(eficiencia_final);
+    
+    // Atualizar estado das demandas
+    for (int k = 0; k < num_demandas_corrida; k++) {
+        Demanda demanda = demandas.getDemanda(demandas_corrida[k]);
+        if (num_demandas_corrida == 1) {
+            demanda.setEstado(INDIVIDUAL);
+        } else {
+            demanda.setEstado(COMBINADA);
+        }
+        demanda.setIndiceCorrida(i);
+    }
+    
+    return corrida_final;
+}
+
+// Agrupa as demandas [inicio, fim) de um lote. A corrida cuja primeira
+// demanda é i fica em corridas_por_base[i]
+void agruparLote(DemandaStore& demandas, const ParametrosFase1& parametros, TrabalhadorFase1& trabalhador,
+                 int inicio, int fim, Corrida** corridas_por_base) {
+    const unsigned char* estados = demandas.getEstados();
+    
+    for (int i = inicio; i < fim; i++) {
+        // Pular demandas já processadas
+        if (estados[i] != DEMANDADA) {
+            continue;
+        }
+        corridas_por_base[i] = agruparBase(demandas, parametros, trabalhador, i, fim);
+    }
+}
@@ -0,0 +1,138 @@
+#include "Arena.hpp"
+#include <cstdint>
+#include <new>
+
+// Tamanho padrão de cada bloco reservado pela arena
+static const size_t TAMANHO_BLOCO_PADRAO = 1 << 20;
+
+// Alinhamento usado pelos operadores new de conveniência
+static const size_t ALINHAMENTO_MAXIMO = alignof(std::max_align_t);
+
+// Construtor padrão
+Arena::Arena() : Arena(TAMANHO_BLOCO_PADRAO) {
+}
+
+// Construtor parametrizado
+Arena::Arena(size_t tamanho_bloco) {
+    this->primeiro = nullptr;
+    this->atual = nullptr;
+    this->tamanho_bloco = tamanho_bloco;
+    this->bytes_em_uso = 0;
+    this->pico_bytes = 0;
+    this->bytes_reservados = 0;
+    this->total_alocacoes = 0;
+    this->total_reinicios = 0;
+}
+
+// Destrutor
+Arena::~Arena() {
+    Bloco* bloco = this->primeiro;
+    while (bloco != nullptr) {
+        Bloco* proximo = bloco->proximo;
+        ::operator delete(bloco);
+        bloco = proximo;
+    }
+}
+
+// Operações principais
+void* Arena::alocar(size_t bytes, size_t alinhamento) {
+    this->total_alocacoes++;
+
+    while (true) {
+        if (this->atual != nullptr) {
+            char* dados = reinterpret_cast<char*>(this->atual + 1);
+            uintptr_t endereco = reinterpret_cast<uintptr_t>(dados + this->atual->usado);
+            size_t ajuste = (alinhamento - endereco % alinhamento) % alinhamento;
+
+            if (this->atual->usado + ajuste + bytes <= this->atual->capacidade) {
+                void* resultado = dados + this->atual->usado + ajuste;
+                this->atual->usado += ajuste + bytes;
+                this->bytes_em_uso += ajuste + bytes;
+                if (this->bytes_em_uso > this->pico_bytes) {
+                    this->pico_bytes = this->bytes_em_uso;
+                }
+                return resultado;
+            }
+
+            // Reaproveita o próximo bloco da lista (mantido após reiniciar)
+            Bloco* proximo = this->atual->proximo;
+            if (proximo != nullptr && proximo->capacidade >= bytes + alinhamento) {
+                proximo->usado = 0;
+                this->atual = proximo;
+                continue;
+            }
+        }
+
+        // Reserva um bloco novo logo após o atual
+        size_t capacidade = this->tamanho_bloco;
+        if (capacidade < bytes + alinhamento) {
+            capacidade = bytes + alinhamento;
+        }
+        Bloco* bloco = novoBloco(capacidade);
+        if (this->atual == nullptr) {
+            bloco->proximo = this->primeiro;
+            this->primeiro = bloco;
+        } else {
+            bloco->proximo = this->atual->proximo;
+            this->atual->proximo = bloco;
+        }
+        this->atual = bloco;
+    }
+}
+
+// Torna toda a memória da arena disponível de novo, sem devolvê-la ao sistema
+void Arena::reiniciar() {
+    this->atual = this->primeiro;
+    if (this->atual != nullptr) {
+        this->atual->usado = 0;
+    }
+    this->bytes_em_uso = 0;
+    this->total_reinicios++;
+}
+
+// Estatísticas
+size_t Arena::getBytesEmUso() const {
+    return this->bytes_em_uso;
+}
+
+size_t Arena::getPicoBytes() const {
+    return this->pico_bytes;
+}
+
+size_t Arena::getBytesReservados() const {
+    return this->bytes_reservados;
+}
+
+long long Arena::getTotalAlocacoes() const {
+    return this->total_alocacoes;
+}
+
+int Arena::getTotalReinicios() const {
+    return this->total_reinicios;
+}
+
+// Métodos privados
+Arena::Bloco* Arena::novoBloco(size_t capacidade) {
+    Bloco* bloco = static_cast<Bloco*>(::operator new(sizeof(Bloco) + capacidade));
+    bloco->proximo = nullptr;
+    bloco->capacidade = capacidade;
+    bloco->usado = 0;
+    this->bytes_reservados += capacidade;
+    return bloco;
+}
+
+// Operadores de alocação na arena
+void* operator new(size_t bytes, Arena& arena) {
+    return arena.alocar(bytes, ALINHAMENTO_MAXIMO);
+}
+
+void* operator new[](size_t bytes, Arena& arena) {
+    return arena.alocar(bytes, ALINHAMENTO_MAXIMO);
+}
+
+// Chamados apenas se um construtor lançar exceção; a memória fica na arena
+void operator delete(void*, Arena&) {
+}
+
+void operator delete[](void*, Arena&) {
+}
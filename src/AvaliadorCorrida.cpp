@@ -0,0 +1,157 @@
+#include "AvaliadorCorrida.hpp"
+#include <cmath>
+
+// Mesma fórmula de Parada::calcularDistancia (início menos fim)
+static double distancia(double x1, double y1, double x2, double y2) {
+    double dx = x1 - x2;
+    double dy = y1 - y2;
+    return sqrt(dx * dx + dy * dy);
+}
+
+// Construtor
+AvaliadorCorrida::AvaliadorCorrida(const DemandaStore* demandas, int capacidade) {
+    this->demandas = demandas;
+    this->capacidade = capacidade > 0 ? capacidade : 1;
+    this->membros = new int[this->capacidade];
+    this->trechos_destino = new double[this->capacidade];
+    this->num_membros = 0;
+    this->soma_origens = 0.0;
+    this->soma_individuais = 0.0;
+    this->candidato = -1;
+    this->candidato_trecho_origem = 0.0;
+    this->candidato_trecho_destino = 0.0;
+    this->candidato_tem_rota = false;
+    this->candidato_rota = 0.0;
+}
+
+// Destrutor
+AvaliadorCorrida::~AvaliadorCorrida() {
+    delete[] this->membros;
+    delete[] this->trechos_destino;
+}
+
+// Operações principais
+
+// Começa um grupo novo contendo apenas a demanda informada
+void AvaliadorCorrida::iniciar(int demanda) {
+    this->membros[0] = demanda;
+    this->trechos_destino[0] = 0.0;
+    this->num_membros = 1;
+    this->soma_origens = 0.0;
+    this->soma_individuais = 0.0 + this->demandas->calcularDistanciaCorrida(demanda);
+    this->candidato = -1;
+}
+
+// Comprimento da rota caso a demanda fosse adicionada ao fim do grupo
+double AvaliadorCorrida::calcularDistanciaComAdicao(int demanda) {
+    avaliarCandidato(demanda);
+    if (this->candidato_tem_rota) {
+        return this->candidato_rota;
+    }
+    return somarRota(this->candidato_trecho_origem, demanda, this->candidato_trecho_destino);
+}
+
+// Eficiência da rota caso a demanda fosse adicionada ao fim do grupo
+double AvaliadorCorrida::calcularEficienciaComAdicao(int demanda) {
+    double distancia_total = calcularDistanciaComAdicao(demanda);
+    if (distancia_total == 0.0) {
+        return 1.0;
+    }
+    double soma = this->soma_individuais + this->demandas->calcularDistanciaCorrida(demanda);
+    return soma / distancia_total;
+}
+
+void AvaliadorCorrida::adicionar(int demanda) {
+    if (this->num_membros >= this->capacidade) {
+        return;
+    }
+    avaliarCandidato(demanda);
+
+    this->soma_origens += this->candidato_trecho_origem;
+    this->soma_individuais += this->demandas->calcularDistanciaCorrida(demanda);
+    this->trechos_destino[this->num_membros] = this->candidato_trecho_destino;
+    this->membros[this->num_membros] = demanda;
+    this->num_membros++;
+    this->candidato = -1;
+}
+
+void AvaliadorCorrida::informarCandidato(int demanda, double trecho_origem, double trecho_destino,
+                                         double rota_par) {
+    this->candidato = demanda;
+    this->candidato_trecho_origem = trecho_origem;
+    this->candidato_trecho_destino = trecho_destino;
+    this->candidato_tem_rota = this->num_membros == 1;
+    this->candidato_rota = rota_par;
+}
+
+void AvaliadorCorrida::copiarDe(const AvaliadorCorrida& outro) {
+    for (int k = 0; k < outro.num_membros; k++) {
+        this->membros[k] = outro.membros[k];
+        this->trechos_destino[k] = outro.trechos_destino[k];
+    }
+    this->num_membros = outro.num_membros;
+    this->soma_origens = outro.soma_origens;
+    this->soma_individuais = outro.soma_individuais;
+    this->candidato = -1;
+}
+
+// Getters
+const int* AvaliadorCorrida::getMembros() const {
+    return this->membros;
+}
+
+int AvaliadorCorrida::getNumMembros() const {
+    return this->num_membros;
+}
+
+double AvaliadorCorrida::getDistanciaTotal() const {
+    int ultimo = this->membros[this->num_membros - 1];
+    int primeiro = this->membros[0];
+    double total = this->soma_origens;
+    total += distancia(this->demandas->getOrigemX(ultimo), this->demandas->getOrigemY(ultimo),
+                       this->demandas->getDestinoX(primeiro), this->demandas->getDestinoY(primeiro));
+    for (int k = 1; k < this->num_membros; k++) {
+        total += this->trechos_destino[k];
+    }
+    return total;
+}
+
+double AvaliadorCorrida::getEficiencia() const {
+    double distancia_total = getDistanciaTotal();
+    if (distancia_total == 0.0) {
+        return 1.0;
+    }
+    return this->soma_individuais / distancia_total;
+}
+
+// Métodos privados
+
+// Calcula (uma única vez por candidato) os trechos novos entre origens e destinos
+void AvaliadorCorrida::avaliarCandidato(int demanda) {
+    if (this->candidato == demanda) {
+        return;
+    }
+    int ultimo = this->membros[this->num_membros - 1];
+    this->candidato_trecho_origem = distancia(
+        this->demandas->getOrigemX(ultimo), this->demandas->getOrigemY(ultimo),
+        this->demandas->getOrigemX(demanda), this->demandas->getOrigemY(demanda));
+    this->candidato_trecho_destino = distancia(
+        this->demandas->getDestinoX(ultimo), this->demandas->getDestinoY(ultimo),
+        this->demandas->getDestinoX(demanda), this->demandas->getDestinoY(demanda));
+    this->candidato = demanda;
+    this->candidato_tem_rota = false;
+}
+
+// Soma os trechos na ordem da rota: origens, origem final -> primeiro destino,
+// destinos já no grupo e, por fim, o trecho até o destino do candidato
+double AvaliadorCorrida::somarRota(double trecho_origem, int origem_final, double trecho_destino) const {
+    int primeiro = this->membros[0];
+    double total = this->soma_origens + trecho_origem;
+    total += distancia(this->demandas->getOrigemX(origem_final), this->demandas->getOrigemY(origem_final),
+                       this->demandas->getDestinoX(primeiro), this->demandas->getDestinoY(primeiro));
+    for (int k = 1; k < this->num_membros; k++) {
+        total += this->trechos_destino[k];
+    }
+    total += trecho_destino;
+    return total;
+}
@@ -0,0 +1,240 @@
+#include "ConfiguracoesVarredura.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static const int TAMANHO_LINHA = 4096;
+
+static const char* NOMES_PARAMETROS[NUM_PARAMETROS_VARREDURA] = {
+    "eta", "gama", "delta", "alfa", "beta", "lambda"
+};
+
+static char* copiarTexto(const char* texto) {
+    size_t tamanho = strlen(texto);
+    char* copia = new char[tamanho + 1];
+    memcpy(copia, texto, tamanho + 1);
+    return copia;
+}
+
+// Construtor
+ConfiguracoesVarredura::ConfiguracoesVarredura() {
+    this->capacidade_configuracoes = 16;
+    this->configuracoes = new ConfiguracaoVarredura[this->capacidade_configuracoes];
+    this->num_configuracoes = 0;
+    this->capacidade_conjuntos = 4;
+    this->caminhos = new char*[this->capacidade_conjuntos];
+    this->num_conjuntos = 0;
+    this->erro[0] = '\0';
+}
+
+// Destrutor
+ConfiguracoesVarredura::~ConfiguracoesVarredura() {
+    for (int c = 0; c < this->num_conjuntos; c++) {
+        delete[] this->caminhos[c];
+    }
+    delete[] this->caminhos;
+    delete[] this->configuracoes;
+}
+
+bool ConfiguracoesVarredura::carregar(const char* caminho) {
+    FILE* arquivo = fopen(caminho, "r");
+    if (arquivo == nullptr) {
+        snprintf(this->erro, sizeof(this->erro), "nao foi possivel abrir %s", caminho);
+        return false;
+    }
+
+    char linha[TAMANHO_LINHA];
+    int numero_linha = 0;
+    bool sucesso = true;
+    while (sucesso && fgets(linha, sizeof(linha), arquivo) != nullptr) {
+        numero_linha++;
+        if (strchr(linha, '\n') == nullptr && !feof(arquivo)) {
+            snprintf(this->erro, sizeof(this->erro), "linha %d longa demais", numero_linha);
+            sucesso = false;
+            break;
+        }
+        sucesso = interpretarLinha(linha, numero_linha);
+    }
+    fclose(arquivo);
+
+    if (sucesso && this->num_configuracoes == 0) {
+        snprintf(this->erro, sizeof(this->erro), "nenhuma configuracao em %s", caminho);
+        sucesso = false;
+    }
+    return sucesso;
+}
+
+// Getters
+int ConfiguracoesVarredura::getNumConfiguracoes() const {
+    return this->num_configuracoes;
+}
+
+ConfiguracaoVarredura& ConfiguracoesVarredura::getConfiguracao(int indice) {
+    return this->configuracoes[indice];
+}
+
+int ConfiguracoesVarredura::getNumConjuntos() const {
+    return this->num_conjuntos;
+}
+
+const char* ConfiguracoesVarredura::getCaminhoConjunto(int conjunto) const {
+    return this->caminhos[conjunto];
+}
+
+const char* ConfiguracoesVarredura::getErro() const {
+    return this->erro;
+}
+
+const char* ConfiguracoesVarredura::getNomeParametro(int parametro) {
+    return NOMES_PARAMETROS[parametro];
+}
+
+// Métodos privados
+bool ConfiguracoesVarredura::interpretarLinha(char* linha, int numero_linha) {
+    const char* separadores = " \t\r\n";
+    char* contexto = nullptr;
+    char* campos[NUM_PARAMETROS_VARREDURA + 2];
+    int num_campos = 0;
+    for (char* campo = strtok_r(linha, separadores, &contexto); campo != nullptr;
+         campo = strtok_r(nullptr, separadores, &contexto)) {
+        if (num_campos == 0 && campo[0] == '#') {
+            return true;
+        }
+        if (num_campos == NUM_PARAMETROS_VARREDURA + 1) {
+            snprintf(this->erro, sizeof(this->erro), "linha %d: campos demais", numero_linha);
+            return false;
+        }
+        campos[num_campos++] = campo;
+    }
+    if (num_campos == 0) {
+        return true;
+    }
+    if (num_campos < NUM_PARAMETROS_VARREDURA) {
+        snprintf(this->erro, sizeof(this->erro), "linha %d: esperados %d parametros", numero_linha,
+                 NUM_PARAMETROS_VARREDURA);
+        return false;
+    }
+
+    double inicios[NUM_PARAMETROS_VARREDURA];
+    double fins[NUM_PARAMETROS_VARREDURA];
+    int pontos[NUM_PARAMETROS_VARREDURA];
+    long long total = 1;
+    for (int p = 0; p < NUM_PARAMETROS_VARREDURA; p++) {
+        if (!interpretarCampo(campos[p], inicios[p], fins[p], pontos[p])) {
+            snprintf(this->erro, sizeof(this->erro), "linha %d: %s invalido (%s)", numero_linha,
+                     NOMES_PARAMETROS[p], campos[p]);
+            return false;
+        }
+        if (pontos[p] > 1) {
+            total *= pontos[p];
+        }
+        if (total + this->num_configuracoes > MAXIMO_CONFIGURACOES) {
+            snprintf(this->erro, sizeof(this->erro), "linha %d: mais de %d configuracoes", numero_linha,
+                     MAXIMO_CONFIGURACOES);
+            return false;
+        }
+    }
+
+    int conjunto = registrarConjunto(num_campos > NUM_PARAMETROS_VARREDURA ? campos[NUM_PARAMETROS_VARREDURA]
+                                                                           : nullptr);
+
+    // Produto cartesiano, com o último parâmetro variando mais rápido
+    int posicoes[NUM_PARAMETROS_VARREDURA] = {0};
+    for (long long k = 0; k < total; k++) {
+        ConfiguracaoVarredura configuracao;
+        configuracao.herdados = 0;
+        configuracao.conjunto = conjunto;
+        for (int p = 0; p < NUM_PARAMETROS_VARREDURA; p++) {
+            if (pontos[p] == 0) {
+                configuracao.herdados |= static_cast<unsigned char>(1 << p);
+                configuracao.valores[p] = 0.0;
+            } else if (pontos[p] == 1) {
+                configuracao.valores[p] = inicios[p];
+            } else {
+                double progresso = static_cast<double>(posicoes[p]) / (pontos[p] - 1);
+                configuracao.valores[p] = inicios[p] + progresso * (fins[p] - inicios[p]);
+            }
+        }
+        adicionar(configuracao);
+
+        for (int p = NUM_PARAMETROS_VARREDURA - 1; p >= 0; p--) {
+            if (pontos[p] > 1 && ++posicoes[p] < pontos[p]) {
+                break;
+            }
+            posicoes[p] = 0;
+        }
+    }
+    return true;
+}
+
+// "-" devolve 0 pontos (herdado do cabeçalho); um número, 1 ponto
+bool ConfiguracoesVarredura::interpretarCampo(const char* campo, double& inicio, double& fim, int& pontos) {
+    if (strcmp(campo, "-") == 0) {
+        pontos = 0;
+        return true;
+    }
+
+    char* resto = nullptr;
+    inicio = strtod(campo, &resto);
+    if (resto == campo) {
+        return false;
+    }
+    if (*resto == '\0') {
+        fim = inicio;
+        pontos = 1;
+        return true;
+    }
+    if (*resto != ':') {
+        return false;
+    }
+
+    const char* campo_fim = resto + 1;
+    fim = strtod(campo_fim, &resto);
+    if (resto == campo_fim || *resto != ':') {
+        return false;
+    }
+    const char* campo_pontos = resto + 1;
+    long quantidade = strtol(campo_pontos, &resto, 10);
+    if (resto == campo_pontos || *resto != '\0' || quantidade < 1 || quantidade > MAXIMO_CONFIGURACOES) {
+        return false;
+    }
+    pontos = static_cast<int>(quantidade);
+    return true;
+}
+
+int ConfiguracoesVarredura::registrarConjunto(const char* caminho) {
+    for (int c = 0; c < this->num_conjuntos; c++) {
+        const char* existente = this->caminhos[c];
+        if ((existente == nullptr && caminho == nullptr) ||
+            (existente != nullptr && caminho != nullptr && strcmp(existente, caminho) == 0)) {
+            return c;
+        }
+    }
+
+    if (this->num_conjuntos == this->capacidade_conjuntos) {
+        int nova_capacidade = 2 * this->capacidade_conjuntos;
+        char** novos = new char*[nova_capacidade];
+        for (int c = 0; c < this->num_conjuntos; c++) {
+            novos[c] = this->caminhos[c];
+        }
+        delete[] this->caminhos;
+        this->caminhos = novos;
+        this->capacidade_conjuntos = nova_capacidade;
+    }
+    this->caminhos[this->num_conjuntos] = caminho != nullptr ? copiarTexto(caminho) : nullptr;
+    return this->num_conjuntos++;
+}
+
+void ConfiguracoesVarredura::adicionar(const ConfiguracaoVarredura& configuracao) {
+    if (this->num_configuracoes == this->capacidade_configuracoes) {
+        int nova_capacidade = 2 * this->capacidade_configuracoes;
+        ConfiguracaoVarredura* novas = new ConfiguracaoVarredura[nova_capacidade];
+        for (int i = 0; i < this->num_configuracoes; i++) {
+            novas[i] = this->configuracoes[i];
+        }
+        delete[] this->configuracoes;
+        this->configuracoes = novas;
+        this->capacidade_configuracoes = nova_capacidade;
+    }
+    this->configuracoes[this->num_configuracoes++] = configuracao;
+}
@@ -0,0 +1,112 @@
+#include "ConstrucaoCorridas.hpp"
+#include "SimulacaoException.hpp"
+#include "Parada.hpp"
+#include "Trecho.hpp"
+
+// Cria os trechos entre as paradas consecutivas da corrida e calcula sua
+// duração e distância total
+void construirTrechos(Corrida* corrida, double gama) {
+    Parada* paradas = corrida->getParadas();
+    int total_paradas = corrida->getNumParadas();
+    
+    for (int i = 0; i < total_paradas - 1; i++) {
+        // Determinar natureza do trecho
+        NaturezaTrecho natureza;
+        if (paradas[i].getTipo() == EMBARQUE && paradas[i+1].getTipo() == EMBARQUE) {
+            natureza = COLETA;
+        } else if (paradas[i].getTipo() == DESEMBARQUE && paradas[i+1].getTipo() == DESEMBARQUE) {
+            natureza = ENTREGA;
+        } else {
+            natureza = DESLOCAMENTO;
+        }
+        
+        Trecho trecho(&paradas[i], &paradas[i+1], 0.0, 0.0, natureza);
+        trecho.calcularTempoDistancia(gama);
+        corrida->adicionarTrecho(trecho);
+    }
+    
+    // Calcular duração e distância total
+    corrida->calcularDuracaoDistancia();
+}
+
+Corrida* construirCorrida(const DemandaStore& demandas, const int* demandas_corrida, int num_demandas,
+                          double gama, double tempo_inicio, Arena& arena) {
+    if (num_demandas <= 0) {
+        throw EstadoInvalidoException("Tentativa de construir corrida sem demandas");
+    }
+    
+    Corrida* corrida = new (arena) Corrida(num_demandas, &arena);
+    corrida->setTempoInicio(tempo_inicio);
+    
+    // Adicionar IDs das demandas
+    for (int i = 0; i < num_demandas; i++) {
+        corrida->adicionarDemanda(demandas.getId(demandas_corrida[i]));
+    }
+    
+    // Criar paradas de embarque (origens) na ordem das demandas
+    for (int i = 0; i < num_demandas; i++) {
+        Parada parada_embarque(
+            demandas.getOrigemX(demandas_corrida[i]),
+            demandas.getOrigemY(demandas_corrida[i]),
+            EMBARQUE,
+            demandas.getId(demandas_corrida[i])
+        );
+        corrida->adicionarParada(parada_embarque);
+    }
+    
+    // Criar paradas de desembarque (destinos) na ordem das demandas
+    for (int i = 0; i < num_demandas; i++) {
+        Parada parada_desembarque(
+            demandas.getDestinoX(demandas_corrida[i]),
+            demandas.getDestinoY(demandas_corrida[i]),
+            DESEMBARQUE,
+            demandas.getId(demandas_corrida[i])
+        );
+        corrida->adicionarParada(parada_desembarque);
+    }
+    
+    construirTrechos(corrida, gama);
+    
+    return corrida;
+}
+
+double calcularEficienciaCorrida(const DemandaStore& demandas, const int* demandas_corrida, int num_demandas,
+                                 double distancia_total) {
+    if (distancia_total == 0.0) {
+        return 1.0;
+    }
+    
+    double soma_distancias_individuais = 0.0;
+    for (int i = 0; i < num_demandas; i++) {
+        soma_distancias_individuais += demandas.calcularDistanciaCorrida(demandas_corrida[i]);
+    }
+    
+    return soma_distancias_individuais / distancia_total;
+}
+
+// Caminho de referência da fase 1: constrói a corrida candidata inteira (no
+// rascunho) só para obter sua eficiência; mantido para comparação
+double avaliarPorReconstrucao(const DemandaStore& demandas, const int* membros, int num_membros,
+                              int candidata, double gama, double tempo_base, Arena& rascunho) {
+    rascunho.reiniciar();
+    int* demandas_corrida = new (rascunho) int[num_membros + 1];
+    for (int k = 0; k < num_membros; k++) {
+        demandas_corrida[k] = membros[k];
+    }
+    demandas_corrida[num_membros] = candidata;
+    
+    Corrida* corrida_temp = construirCorrida(demandas, demandas_corrida, num_membros + 1, gama, tempo_base, rascunho);
+    return calcularEficienciaCorrida(demandas, demandas_corrida, num_membros + 1, corrida_temp->getDistanciaTotal());
+}
+
+// Avanço direto: as corridas não interagem durante a simulação, então a
+// conclusão é a partida mais a duração de cada trecho, somadas na mesma
+// ordem dos eventos para dar exatamente o mesmo tempo
+double calcularConclusaoDireta(Corrida* corrida, double partida) {
+    Trecho* trechos = corrida->getTrechos();
+    double tempo = partida;
+    for (int parada = 0; parada < corrida->getNumParadas() - 1; parada++) {
+        tempo = tempo + trechos[parada].getTempo();
+    }
+    return tempo;
+}
@@ -1,19 +1,20 @@
 #include "Corrida.hpp"
+#include "Arena.hpp"
 #include <cmath>
+#include <new>
+
+// Reposiciona um ponteiro para parada do bloco antigo no bloco novo
+static Parada* relocarParada(Parada* parada, Parada* antigas, int num_paradas, Parada* novas) {
+    if (parada >= antigas && parada < antigas + num_paradas) {
+        return novas + (parada - antigas);
+    }
+    return parada;
+}
 
 // Construtor padrão
 Corrida::Corrida() {
-    this->capacidade_ids = 2;
-    this->ids_demandas = new int[this->capacidade_ids];
-    this->num_demandas = 0;
-    
-    this->capacidade_trechos = 4;
-    this->trechos = new Trecho*[this->capacidade_trechos];
-    this->num_trechos = 0;
-    
-    this->capacidade_paradas = 4;
-    this->paradas = new Parada*[this->capacidade_paradas];
-    this->num_paradas = 0;
+    this->arena = nullptr;
+    alocarBloco(2);
     
     this->duracao_total = 0.0;
     this->distancia_total = 0.0;
@@ -22,18 +23,13 @@ Corrida::Corrida() {
 }
 
 // Construtor parametrizado
-Corrida::Corrida(int capacidade_inicial) {
-    this->capacidade_ids = capacidade_inicial;
-    this->ids_demandas = new int[this->capacidade_ids];
-    this->num_demandas = 0;
-    
-    this->capacidade_trechos = capacidade_inicial * 2;
-    this->trechos = new Trecho*[this->capacidade_trechos];
-    this->num_trechos = 0;
-    
-    this->capacidade_paradas = capacidade_inicial * 2;
-    this->paradas = new Parada*[this->capacidade_paradas];
-    this->num_paradas = 0;
+Corrida::Corrida(int capacidade_inicial) : Corrida(capacidade_inicial, nullptr) {
+}
+
+// Construtor com arena: o bloco de paradas/trechos/IDs é tirado da arena
+Corrida::Corrida(int capacidade_inicial, Arena* arena) {
+    this->arena = arena;
+    alocarBloco(capacidade_inicial > 0 ? capacidade_inicial : 1);
     
     this->duracao_total = 0.0;
     this->distancia_total = 0.0;
@@ -43,19 +39,7 @@ Corrida::Corrida(int capacidade_inicial) {
 
 // Destrutor
 Corrida::~Corrida() {
-    delete[] this->ids_demandas;
-    
-    // Deletar os trechos
-    for (int i = 0; i < this->num_trechos; i++) {
-        delete this->trechos[i];
-    }
-    delete[] this->trechos;
-    
-    // Deletar as paradas
-    for (int i = 0; i < this->num_paradas; i++) {
-        delete this->paradas[i];
-    }
-    delete[] this->paradas;
+    liberarBloco();
 }
 
 // Getters
@@ -67,7 +51,7 @@ int Corrida::getNumDemandas() const {
     return this->num_demandas;
 }
 
-Trecho** Corrida::getTrechos() const {
+Trecho* Corrida::getTrechos() const {
     return this->trechos;
 }
 
@@ -75,7 +59,7 @@ int Corrida::getNumTrechos() const {
     return this->num_trechos;
 }
 
-Parada** Corrida::getParadas() const {
+Parada* Corrida::getParadas() const {
     return this->paradas;
 }
 
@@ -120,26 +104,31 @@ void Corrida::setTempoInicio(double tempo) {
 
 // Métodos de manipulação
 void Corrida::adicionarDemanda(int id_demanda) {
-    if (this->num_demandas >= this->capacidade_ids) {
-        redimensionarIds();
+    if (this->num_demandas >= this->capacidade) {
+        redimensionar();
     }
     this->ids_demandas[this->num_demandas] = id_demanda;
     this->num_demandas++;
 }
 
-void Corrida::adicionarTrecho(Trecho* trecho) {
-    if (this->num_trechos >= this->capacidade_trechos) {
-        redimensionarTrechos();
+void Corrida::adicionarTrecho(const Trecho& trecho) {
+    Trecho copia = trecho;
+    if (this->num_trechos >= 2 * this->capacidade) {
+        Parada* antigas = this->paradas;
+        redimensionar();
+        // O trecho recebido pode apontar para paradas do bloco anterior
+        copia.setParadaInicio(relocarParada(copia.getParadaInicio(), antigas, this->num_paradas, this->paradas));
+        copia.setParadaFim(relocarParada(copia.getParadaFim(), antigas, this->num_paradas, this->paradas));
     }
-    this->trechos[this->num_trechos] = trecho;
+    new (&this->trechos[this->num_trechos]) Trecho(copia);
     this->num_trechos++;
 }
 
-void Corrida::adicionarParada(Parada* parada) {
-    if (this->num_paradas >= this->capacidade_paradas) {
-        redimensionarParadas();
+void Corrida::adicionarParada(const Parada& parada) {
+    if (this->num_paradas >= 2 * this->capacidade) {
+        redimensionar();
     }
-    this->paradas[this->num_paradas] = parada;
+    new (&this->paradas[this->num_paradas]) Parada(parada);
     this->num_paradas++;
 }
 
@@ -163,8 +152,8 @@ void Corrida::calcularDuracaoDistancia() {
     this->distancia_total = 0.0;
     
     for (int i = 0; i < this->num_trechos; i++) {
-        this->duracao_total += this->trechos[i]->getTempo();
-        this->distancia_total += this->trechos[i]->getDistancia();
+        this->duracao_total += this->trechos[i].getTempo();
+        this->distancia_total += this->trechos[i].getDistancia();
     }
 }
 
@@ -179,10 +168,10 @@ bool Corrida::contemDemanda(int id_demanda) const {
 
 // ==================== NOVOS MÉTODOS PARA CORRIDA DINÂMICA ====================
 
-// Limpa todos os trechos (mas não deleta as paradas)
+// Limpa todos os trechos (mas não remove as paradas)
 void Corrida::limparTrechos() {
     for (int i = 0; i < this->num_trechos; i++) {
-        delete this->trechos[i];
+        this->trechos[i].~Trecho();
     }
     this->num_trechos = 0;
     this->duracao_total = 0.0;
@@ -192,7 +181,7 @@ void Corrida::limparTrechos() {
 // Limpa todas as paradas
 void Corrida::limparParadas() {
     for (int i = 0; i < this->num_paradas; i++) {
-        delete this->paradas[i];
+        this->paradas[i].~Parada();
     }
     this->num_paradas = 0;
 }
@@ -206,16 +195,16 @@ void Corrida::reconstruirRota(double velocidade) {
     for (int i = 0; i < this->num_paradas - 1; i++) {
         // Determinar natureza do trecho
         NaturezaTrecho natureza;
-        if (this->paradas[i]->getTipo() == EMBARQUE && this->paradas[i+1]->getTipo() == EMBARQUE) {
+        if (this->paradas[i].getTipo() == EMBARQUE && this->paradas[i+1].getTipo() == EMBARQUE) {
             natureza = COLETA;
-        } else if (this->paradas[i]->getTipo() == DESEMBARQUE && this->paradas[i+1]->getTipo() == DESEMBARQUE) {
+        } else if (this->paradas[i].getTipo() == DESEMBARQUE && this->paradas[i+1].getTipo() == DESEMBARQUE) {
             natureza = ENTREGA;
         } else {
             natureza = DESLOCAMENTO;
         }
         
-        Trecho* trecho = new Trecho(this->paradas[i], this->paradas[i+1], 0.0, 0.0, natureza);
-        trecho->calcularTempoDistancia(velocidade);
+        Trecho trecho(&this->paradas[i], &this->paradas[i+1], 0.0, 0.0, natureza);
+        trecho.calcularTempoDistancia(velocidade);
         adicionarTrecho(trecho);
     }
     
@@ -223,44 +212,39 @@ void Corrida::reconstruirRota(double velocidade) {
     calcularDuracaoDistancia();
 }
 
-// Cria uma cópia profunda da corrida para testes
+// Cria uma cópia profunda da corrida para testes (uma única alocação de bloco)
 Corrida* Corrida::clonar() const {
-    Corrida* clone = new Corrida(this->num_demandas);
+    return clonar(nullptr);
+}
+
+// Com arena, tanto o objeto quanto o bloco do clone são alocados nela
+Corrida* Corrida::clonar(Arena* arena) const {
+    Corrida* clone;
+    if (arena != nullptr) {
+        clone = new (*arena) Corrida(this->capacidade, arena);
+    } else {
+        clone = new Corrida(this->capacidade);
+    }
     
     // Copiar IDs das demandas
     for (int i = 0; i < this->num_demandas; i++) {
-        clone->adicionarDemanda(this->ids_demandas[i]);
+        clone->ids_demandas[i] = this->ids_demandas[i];
     }
+    clone->num_demandas = this->num_demandas;
     
-    // Copiar paradas (criar novas instâncias)
+    // Copiar paradas
     for (int i = 0; i < this->num_paradas; i++) {
-        Parada* parada_original = this->paradas[i];
-        Parada* parada_clone = new Parada(
-            parada_original->getCoordX(),
-            parada_original->getCoordY(),
-            parada_original->getTipo(),
-            parada_original->getIdDemanda()
-        );
-        clone->adicionarParada(parada_clone);
+        new (&clone->paradas[i]) Parada(this->paradas[i]);
     }
+    clone->num_paradas = this->num_paradas;
     
-    // Copiar trechos (criar novas instâncias)
+    // Copiar trechos, apontando para as paradas correspondentes no clone
     for (int i = 0; i < this->num_trechos; i++) {
-        Trecho* trecho_original = this->trechos[i];
-        
-        // Obter paradas correspondentes no clone
-        Parada* parada_origem = clone->paradas[i];
-        Parada* parada_destino = clone->paradas[i + 1];
-        
-        Trecho* trecho_clone = new Trecho(
-            parada_origem,
-            parada_destino,
-            trecho_original->getTempo(),
-            trecho_original->getDistancia(),
-            trecho_original->getNatureza()
-        );
-        clone->adicionarTrecho(trecho_clone);
+        Trecho* trecho_clone = new (&clone->trechos[i]) Trecho(this->trechos[i]);
+        trecho_clone->setParadaInicio(relocarParada(trecho_clone->getParadaInicio(), this->paradas, this->num_paradas, clone->paradas));
+        trecho_clone->setParadaFim(relocarParada(trecho_clone->getParadaFim(), this->paradas, this->num_paradas, clone->paradas));
     }
+    clone->num_trechos = this->num_trechos;
     
     // Copiar atributos
     clone->setDuracaoTotal(this->duracao_total);
@@ -271,42 +255,68 @@ Corrida* Corrida::clonar() const {
     return clone;
 }
 
-// Métodos privados de redimensionamento
-void Corrida::redimensionarIds() {
-    int nova_capacidade = this->capacidade_ids * 2;
-    int* novo_array = new int[nova_capacidade];
+// Métodos privados do bloco de armazenamento
+
+// Aloca o bloco com paradas (2 por demanda), trechos (2 por demanda) e IDs
+void Corrida::alocarBloco(int capacidade) {
+    size_t bytes_paradas = sizeof(Parada) * 2 * capacidade;
+    size_t bytes_trechos = sizeof(Trecho) * 2 * capacidade;
+    size_t bytes_ids = sizeof(int) * capacidade;
     
-    for (int i = 0; i < this->num_demandas; i++) {
-        novo_array[i] = this->ids_demandas[i];
+    if (this->arena != nullptr) {
+        this->bloco = static_cast<char*>(this->arena->alocar(bytes_paradas + bytes_trechos + bytes_ids, alignof(Trecho)));
+    } else {
+        this->bloco = new char[bytes_paradas + bytes_trechos + bytes_ids];
     }
-    
-    delete[] this->ids_demandas;
-    this->ids_demandas = novo_array;
-    this->capacidade_ids = nova_capacidade;
+    this->capacidade = capacidade;
+    this->paradas = reinterpret_cast<Parada*>(this->bloco);
+    this->trechos = reinterpret_cast<Trecho*>(this->bloco + bytes_paradas);
+    this->ids_demandas = reinterpret_cast<int*>(this->bloco + bytes_paradas + bytes_trechos);
+    this->num_paradas = 0;
+    this->num_trechos = 0;
+    this->num_demandas = 0;
 }
 
-void Corrida::redimensionarTrechos() {
-    int nova_capacidade = this->capacidade_trechos * 2;
-    Trecho** novo_array = new Trecho*[nova_capacidade];
-    
-    for (int i = 0; i < this->num_trechos; i++) {
-        novo_array[i] = this->trechos[i];
+void Corrida::liberarBloco() {
+    limparTrechos();
+    limparParadas();
+    if (this->arena == nullptr) {
+        delete[] this->bloco;
     }
-    
-    delete[] this->trechos;
-    this->trechos = novo_array;
-    this->capacidade_trechos = nova_capacidade;
+    this->bloco = nullptr;
 }
 
-void Corrida::redimensionarParadas() {
-    int nova_capacidade = this->capacidade_paradas * 2;
-    Parada** novo_array = new Parada*[nova_capacidade];
+// Dobra a capacidade, movendo os três arrays e religando os trechos
+void Corrida::redimensionar() {
+    char* bloco_antigo = this->bloco;
+    Parada* paradas_antigas = this->paradas;
+    Trecho* trechos_antigos = this->trechos;
+    int* ids_antigos = this->ids_demandas;
+    int num_paradas = this->num_paradas;
+    int num_trechos = this->num_trechos;
+    int num_demandas = this->num_demandas;
     
-    for (int i = 0; i < this->num_paradas; i++) {
-        novo_array[i] = this->paradas[i];
+    alocarBloco(this->capacidade * 2);
+    
+    for (int i = 0; i < num_paradas; i++) {
+        new (&this->paradas[i]) Parada(paradas_antigas[i]);
+        paradas_antigas[i].~Parada();
+    }
+    for (int i = 0; i < num_trechos; i++) {
+        Trecho* trecho = new (&this->trechos[i]) Trecho(trechos_antigos[i]);
+        trecho->setParadaInicio(relocarParada(trecho->getParadaInicio(), paradas_antigas, num_paradas, this->paradas));
+        trecho->setParadaFim(relocarParada(trecho->getParadaFim(), paradas_antigas, num_paradas, this->paradas));
+        trechos_antigos[i].~Trecho();
+    }
+    for (int i = 0; i < num_demandas; i++) {
+        this->ids_demandas[i] = ids_antigos[i];
     }
+    this->num_paradas = num_paradas;
+    this->num_trechos = num_trechos;
+    this->num_demandas = num_demandas;
     
-    delete[] this->paradas;
-    this->paradas = novo_array;
-    this->capacidade_paradas = nova_capacidade;
-}
\ No newline at end of file
+    // Blocos da arena são liberados junto com ela
+    if (this->arena == nullptr) {
+        delete[] bloco_antigo;
+    }
+}
@@ -1,112 +1,263 @@
 #include "Demanda.hpp"
 #include <cmath>
+#include <cstring>
+
+// ==================== CLASSE DEMANDASTORE ====================
 
 // Construtor padrão
-Demanda::Demanda() {
-    this->id = -1;
-    this->tempo_solicitacao = 0.0;
-    this->origem_x = 0.0;
-    this->origem_y = 0.0;
-    this->destino_x = 0.0;
-    this->destino_y = 0.0;
-    this->estado = DEMANDADA;
-    this->corrida_associada = nullptr;
-    this->tempo_conclusao = 0.0;
-    this->distancia_percorrida = 0.0;
+DemandaStore::DemandaStore() : DemandaStore(16) {
 }
 
 // Construtor parametrizado
-Demanda::Demanda(int id, double tempo, double ox, double oy, double dx, double dy) {
-    this->id = id;
-    this->tempo_solicitacao = tempo;
-    this->origem_x = ox;
-    this->origem_y = oy;
-    this->destino_x = dx;
-    this->destino_y = dy;
-    this->estado = DEMANDADA;
-    this->corrida_associada = nullptr;
-    this->tempo_conclusao = 0.0;
-    this->distancia_percorrida = 0.0;
+DemandaStore::DemandaStore(int capacidade_inicial) {
+    if (capacidade_inicial < 1) {
+        capacidade_inicial = 1;
+    }
+    this->capacidade = capacidade_inicial;
+    this->tamanho = 0;
+    this->ids = new int[this->capacidade];
+    this->tempos = new double[this->capacidade];
+    this->origens_x = new double[this->capacidade];
+    this->origens_y = new double[this->capacidade];
+    this->destinos_x = new double[this->capacidade];
+    this->destinos_y = new double[this->capacidade];
+    this->estados = new unsigned char[this->capacidade];
+    this->indices_corrida = new int[this->capacidade];
 }
 
 // Destrutor
-Demanda::~Demanda() {
-    // Corrida será gerenciada externamente, não deletamos aqui
+DemandaStore::~DemandaStore() {
+    delete[] this->ids;
+    delete[] this->tempos;
+    delete[] this->origens_x;
+    delete[] this->origens_y;
+    delete[] this->destinos_x;
+    delete[] this->destinos_y;
+    delete[] this->estados;
+    delete[] this->indices_corrida;
+}
+
+// Inserção
+void DemandaStore::adicionar(int id, double tempo, double ox, double oy, double dx, double dy) {
+    if (this->tamanho >= this->capacidade) {
+        redimensionar();
+    }
+    int i = this->tamanho;
+    this->ids[i] = id;
+    this->tempos[i] = tempo;
+    this->origens_x[i] = ox;
+    this->origens_y[i] = oy;
+    this->destinos_x[i] = dx;
+    this->destinos_y[i] = dy;
+    this->estados[i] = DEMANDADA;
+    this->indices_corrida[i] = -1;
+    this->tamanho++;
+}
+
+void DemandaStore::descartarPrimeiras(int quantidade) {
+    if (quantidade <= 0) {
+        return;
+    }
+    if (quantidade > this->tamanho) {
+        quantidade = this->tamanho;
+    }
+    int restantes = this->tamanho - quantidade;
+    memmove(this->ids, this->ids + quantidade, restantes * sizeof(int));
+    memmove(this->tempos, this->tempos + quantidade, restantes * sizeof(double));
+    memmove(this->origens_x, this->origens_x + quantidade, restantes * sizeof(double));
+    memmove(this->origens_y, this->origens_y + quantidade, restantes * sizeof(double));
+    memmove(this->destinos_x, this->destinos_x + quantidade, restantes * sizeof(double));
+    memmove(this->destinos_y, this->destinos_y + quantidade, restantes * sizeof(double));
+    memmove(this->estados, this->estados + quantidade, restantes * sizeof(unsigned char));
+    memmove(this->indices_corrida, this->indices_corrida + quantidade, restantes * sizeof(int));
+    this->tamanho = restantes;
+}
+
+// Visão sobre uma demanda
+Demanda DemandaStore::getDemanda(int indice) {
+    return Demanda(this, indice);
+}
+
+// Acesso às colunas
+int DemandaStore::getTamanho() const {
+    return this->tamanho;
+}
+
+const int* DemandaStore::getIds() const {
+    return this->ids;
+}
+
+const double* DemandaStore::getTempos() const {
+    return this->tempos;
+}
+
+const double* DemandaStore::getOrigensX() const {
+    return this->origens_x;
+}
+
+const double* DemandaStore::getOrigensY() const {
+    return this->origens_y;
+}
+
+const double* DemandaStore::getDestinosX() const {
+    return this->destinos_x;
+}
+
+const double* DemandaStore::getDestinosY() const {
+    return this->destinos_y;
+}
+
+const unsigned char* DemandaStore::getEstados() const {
+    return this->estados;
+}
+
+// Acesso por índice
+int DemandaStore::getId(int indice) const {
+    return this->ids[indice];
+}
+
+double DemandaStore::getTempoSolicitacao(int indice) const {
+    return this->tempos[indice];
+}
+
+double DemandaStore::getOrigemX(int indice) const {
+    return this->origens_x[indice];
+}
+
+double DemandaStore::getOrigemY(int indice) const {
+    return this->origens_y[indice];
+}
+
+double DemandaStore::getDestinoX(int indice) const {
+    return this->destinos_x[indice];
+}
+
+double DemandaStore::getDestinoY(int indice) const {
+    return this->destinos_y[indice];
+}
+
+EstadoDemanda DemandaStore::getEstado(int indice) const {
+    return static_cast<EstadoDemanda>(this->estados[indice]);
+}
+
+int DemandaStore::getIndiceCorrida(int indice) const {
+    return this->indices_corrida[indice];
+}
+
+void DemandaStore::setEstado(int indice, EstadoDemanda estado) {
+    this->estados[indice] = static_cast<unsigned char>(estado);
+}
+
+void DemandaStore::setIndiceCorrida(int indice, int indice_corrida) {
+    this->indices_corrida[indice] = indice_corrida;
+}
+
+// Métodos auxiliares
+double DemandaStore::calcularDistanciaOrigem(int indice, int outra) const {
+    double dx = this->origens_x[indice] - this->origens_x[outra];
+    double dy = this->origens_y[indice] - this->origens_y[outra];
+    return sqrt(dx * dx + dy * dy);
+}
+
+double DemandaStore::calcularDistanciaDestino(int indice, int outra) const {
+    double dx = this->destinos_x[indice] - this->destinos_x[outra];
+    double dy = this->destinos_y[indice] - this->destinos_y[outra];
+    return sqrt(dx * dx + dy * dy);
+}
+
+double DemandaStore::calcularDistanciaCorrida(int indice) const {
+    double dx = this->destinos_x[indice] - this->origens_x[indice];
+    double dy = this->destinos_y[indice] - this->origens_y[indice];
+    return sqrt(dx * dx + dy * dy);
+}
+
+// Método privado de redimensionamento
+template <typename T>
+static void redimensionarColuna(T*& coluna, int tamanho, int nova_capacidade) {
+    T* nova_coluna = new T[nova_capacidade];
+    for (int i = 0; i < tamanho; i++) {
+        nova_coluna[i] = coluna[i];
+    }
+    delete[] coluna;
+    coluna = nova_coluna;
+}
+
+void DemandaStore::redimensionar() {
+    int nova_capacidade = this->capacidade * 2;
+    redimensionarColuna(this->ids, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->tempos, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->origens_x, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->origens_y, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->destinos_x, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->destinos_y, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->estados, this->tamanho, nova_capacidade);
+    redimensionarColuna(this->indices_corrida, this->tamanho, nova_capacidade);
+    this->capacidade = nova_capacidade;
+}
+
+// ==================== CLASSE DEMANDA ====================
+
+// Construtor
+Demanda::Demanda(DemandaStore* store, int indice) {
+    this->store = store;
+    this->indice = indice;
 }
 
 // Getters
+int Demanda::getIndice() const {
+    return this->indice;
+}
+
 int Demanda::getId() const {
-    return this->id;
+    return this->store->getId(this->indice);
 }
 
 double Demanda::getTempoSolicitacao() const {
-    return this->tempo_solicitacao;
+    return this->store->getTempoSolicitacao(this->indice);
 }
 
 double Demanda::getOrigemX() const {
-    return this->origem_x;
+    return this->store->getOrigemX(this->indice);
 }
 
 double Demanda::getOrigemY() const {
-    return this->origem_y;
+    return this->store->getOrigemY(this->indice);
 }
 
 double Demanda::getDestinoX() const {
-    return this->destino_x;
+    return this->store->getDestinoX(this->indice);
 }
 
 double Demanda::getDestinoY() const {
-    return this->destino_y;
+    return this->store->getDestinoY(this->indice);
 }
 
 EstadoDemanda Demanda::getEstado() const {
-    return this->estado;
-}
-
-Corrida* Demanda::getCorridaAssociada() const {
-    return this->corrida_associada;
-}
-
-double Demanda::getTempoConclusao() const {
-    return this->tempo_conclusao;
+    return this->store->getEstado(this->indice);
 }
 
-double Demanda::getDistanciaPercorrida() const {
-    return this->distancia_percorrida;
+int Demanda::getIndiceCorrida() const {
+    return this->store->getIndiceCorrida(this->indice);
 }
 
 // Setters
 void Demanda::setEstado(EstadoDemanda novo_estado) {
-    this->estado = novo_estado;
-}
-
-void Demanda::setCorridaAssociada(Corrida* corrida) {
-    this->corrida_associada = corrida;
-}
-
-void Demanda::setTempoConclusao(double tempo) {
-    this->tempo_conclusao = tempo;
+    this->store->setEstado(this->indice, novo_estado);
 }
 
-void Demanda::setDistanciaPercorrida(double distancia) {
-    this->distancia_percorrida = distancia;
+void Demanda::setIndiceCorrida(int indice_corrida) {
+    this->store->setIndiceCorrida(this->indice, indice_corrida);
 }
 
 // Métodos auxiliares
 double Demanda::calcularDistanciaOrigem(const Demanda& outra) const {
-    double dx = this->origem_x - outra.origem_x;
-    double dy = this->origem_y - outra.origem_y;
-    return sqrt(dx * dx + dy * dy);
+    return this->store->calcularDistanciaOrigem(this->indice, outra.indice);
 }
 
 double Demanda::calcularDistanciaDestino(const Demanda& outra) const {
-    double dx = this->destino_x - outra.destino_x;
-    double dy = this->destino_y - outra.destino_y;
-    return sqrt(dx * dx + dy * dy);
+    return this->store->calcularDistanciaDestino(this->indice, outra.indice);
 }
 
 double Demanda::calcularDistanciaCorrida() const {
-    double dx = this->destino_x - this->origem_x;
-    double dy = this->destino_y - this->origem_y;
-    return sqrt(dx * dx + dy * dy);
-}
\ No newline at end of file
+    return this->store->calcularDistanciaCorrida(this->indice);
+}
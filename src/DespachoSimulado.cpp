@@ -0,0 +1,226 @@
+#include "DespachoSimulado.hpp"
+#include "ConstrucaoCorridas.hpp"
+#include "SimulacaoException.hpp"
+#include "Parada.hpp"
+#include <cmath>
+#include <string>
+
+// Corrida ativa candidata, indexada pela última parada: o desembarque novo
+// vai para o fim da rota, então o desvio é ao menos a distância da última
+// parada até ele (com a mesma folga de arredondamento do índice da fase 2)
+static void registrarCorridaAtiva(IndiceCorridas& ativas, Corrida* corrida, int indice_corrida, int eta) {
+    int num = corrida->getNumDemandas();
+    if (num < 2 || num >= eta) {
+        ativas.remover(indice_corrida);
+        return;
+    }
+    
+    Parada& ultima = corrida->getParadas()[corrida->getNumParadas() - 1];
+    double limite = (num + 2) * (corrida->getDistanciaTotal() + 1501.0);
+    if (limite <= LIMITE_ARREDONDAMENTO_ROTA && std::isfinite(ultima.getCoordX()) &&
+        std::isfinite(ultima.getCoordY())) {
+        ativas.inserir(indice_corrida, ultima.getCoordX(), ultima.getCoordY());
+    } else {
+        ativas.inserirGlobal(indice_corrida);
+    }
+}
+
+// Eficiência pela própria rota: a distância de cada demanda vai do seu
+// embarque ao seu desembarque, somadas na ordem das demandas como em
+// calcularEficienciaCorrida
+static double calcularEficienciaRota(Corrida* corrida) {
+    if (corrida->getDistanciaTotal() == 0.0) {
+        return 1.0;
+    }
+    
+    int* ids = corrida->getIdsDemandas();
+    Parada* paradas = corrida->getParadas();
+    double soma_distancias_individuais = 0.0;
+    for (int k = 0; k < corrida->getNumDemandas(); k++) {
+        Parada* embarque = nullptr;
+        Parada* desembarque = nullptr;
+        for (int p = 0; p < corrida->getNumParadas(); p++) {
+            if (paradas[p].getIdDemanda() != ids[k]) {
+                continue;
+            }
+            if (paradas[p].getTipo() == EMBARQUE) {
+                embarque = &paradas[p];
+            } else {
+                desembarque = &paradas[p];
+            }
+        }
+        if (embarque == nullptr || desembarque == nullptr) {
+            throw EstadoInvalidoException("Demanda " + std::to_string(ids[k]) + " sem embarque ou desembarque na rota");
+        }
+        soma_distancias_individuais += desembarque->calcularDistancia(*embarque);
+    }
+    
+    return soma_distancias_individuais / corrida->getDistanciaTotal();
+}
+
+// Constrói na arena a corrida com a demanda adicional, replanejada a partir
+// da próxima parada do veículo. As paradas até proxima_parada (inclusive)
+// são mantidas; o embarque novo entra depois delas e de todos os embarques
+// da corrida, e o desembarque novo no fim. Enquanto o veículo não passou
+// dos embarques, a rota é a mesma de construirInsercao
+static Corrida* construirReplanejamento(const DemandaStore& demandas, Corrida* corrida_antiga, int proxima_parada,
+                                        int demanda, double gama, Arena& arena) {
+    int num_paradas_antiga = corrida_antiga->getNumParadas();
+    Parada* paradas_antiga = corrida_antiga->getParadas();
+    int* ids_antiga = corrida_antiga->getIdsDemandas();
+    int id = demandas.getId(demanda);
+    
+    int posicao_embarque = proxima_parada + 1;
+    for (int p = posicao_embarque; p < num_paradas_antiga; p++) {
+        if (paradas_antiga[p].getTipo() == EMBARQUE) {
+            posicao_embarque = p + 1;
+        }
+    }
+    
+    Corrida* nova_corrida = new (arena) Corrida(corrida_antiga->getNumDemandas() + 1, &arena);
+    nova_corrida->setTempoInicio(corrida_antiga->getTempoInicio());
+    for (int k = 0; k < corrida_antiga->getNumDemandas(); k++) {
+        nova_corrida->adicionarDemanda(ids_antiga[k]);
+    }
+    nova_corrida->adicionarDemanda(id);
+    
+    for (int p = 0; p < posicao_embarque; p++) {
+        nova_corrida->adicionarParada(paradas_antiga[p]);
+    }
+    nova_corrida->adicionarParada(Parada(demandas.getOrigemX(demanda), demandas.getOrigemY(demanda), EMBARQUE, id));
+    for (int p = posicao_embarque; p < num_paradas_antiga; p++) {
+        nova_corrida->adicionarParada(paradas_antiga[p]);
+    }
+    nova_corrida->adicionarParada(Parada(demandas.getDestinoX(demanda), demandas.getDestinoY(demanda), DESEMBARQUE, id));
+    
+    construirTrechos(nova_corrida, gama);
+    nova_corrida->setEficiencia(calcularEficienciaRota(nova_corrida));
+    return nova_corrida;
+}
+
+// Construtor
+DespachoSimulado::DespachoSimulado(int capacidade)
+    : ativas(capacidade, DESVIO_MAXIMO_ABSOLUTO), candidatas(new int[capacidade]),
+      demanda_por_corrida(new int[capacidade]), chegadas(new int[capacidade]), num_chegadas(0),
+      tempo_chegadas(0.0), num_ativas(0), total_chegadas(0), total_inseridas(0), candidatas_avaliadas(0),
+      maior_num_ativas(0) {}
+
+// Destrutor
+DespachoSimulado::~DespachoSimulado() {
+    delete[] this->candidatas;
+    delete[] this->demanda_por_corrida;
+    delete[] this->chegadas;
+}
+
+// Operações principais
+
+// Atualiza a corrida no conjunto de ativas (ou a retira dele)
+void DespachoSimulado::atualizarAtiva(Corrida* corrida, int indice_corrida, int eta, bool em_andamento) {
+    bool estava = this->ativas.contem(indice_corrida);
+    if (em_andamento) {
+        registrarCorridaAtiva(this->ativas, corrida, indice_corrida, eta);
+    } else {
+        this->ativas.remover(indice_corrida);
+    }
+    this->num_ativas += (this->ativas.contem(indice_corrida) ? 1 : 0) - (estava ? 1 : 0);
+    if (this->num_ativas > this->maior_num_ativas) {
+        this->maior_num_ativas = this->num_ativas;
+    }
+}
+
+// Melhor corrida ativa para a demanda, pelos mesmos critérios da fase 2.
+// As candidatas são construídas no rascunho com a rota replanejada
+static InsercaoEscolhida buscarInsercaoAtiva(const DemandaStore& demandas, const TabelaCorridas& corridas,
+                                             const Escalonador& escalonador, DespachoSimulado& despacho, int demanda,
+                                             const ParametrosFase2& parametros, Arena& rascunho) {
+    InsercaoEscolhida melhor = nenhumaInsercao(parametros);
+    
+    // Um desvio não finito nunca é aceito
+    double destino_x = demandas.getDestinoX(demanda);
+    double destino_y = demandas.getDestinoY(demanda);
+    if (!std::isfinite(destino_x) || !std::isfinite(destino_y)) {
+        return melhor;
+    }
+    
+    int num_candidatas = despacho.ativas.buscar(destino_x, destino_y, raioBuscaInsercao(parametros),
+                                                despacho.candidatas);
+    for (int c = 0; c < num_candidatas; c++) {
+        int j = despacho.candidatas[c];
+        Corrida* corrida_candidata = corridas.getCorrida(j);
+        Evento* pendente = escalonador.getEvento(corridas.getEventoPendente(j));
+        if (pendente == nullptr) {
+            throw EstadoInvalidoException("Corrida ativa " + std::to_string(j) + " sem evento pendente");
+        }
+        
+        // Corridas que não podem superar a melhor até aqui
+        if (despacho.ativas.estaNaGrade(j)) {
+            Parada& ultima = corrida_candidata->getParadas()[corrida_candidata->getNumParadas() - 1];
+            double dx = ultima.getCoordX() - destino_x;
+            double dy = ultima.getCoordY() - destino_y;
+            if (sqrt(dx * dx + dy * dy) - MARGEM_LIMITE_DESVIO > melhor.custo) {
+                continue;
+            }
+        }
+        
+        Corrida* corrida_temp = construirReplanejamento(demandas, corrida_candidata, pendente->getIndiceParada(),
+                                                        demanda, parametros.gama, rascunho);
+        double custo_adicional = corrida_temp->getDistanciaTotal() - corrida_candidata->getDistanciaTotal();
+        despacho.candidatas_avaliadas++;
+        
+        if (melhoraInsercao(melhor, j, custo_adicional, corrida_temp->getEficiencia(), parametros)) {
+            melhor.corrida = j;
+            melhor.custo = custo_adicional;
+        }
+    }
+    
+    return melhor;
+}
+
+// Despacha as chegadas acumuladas de um mesmo tempo, na ordem da entrada.
+// Uma demanda aceita entra na corrida escolhida, cujo evento pendente passa
+// a apontar para a rota replanejada, e a sua corrida individual é
+// descartada; as demais partem na corrida individual. Retorna o número de
+// inserções
+int despacharChegadas(DemandaStore& demandas, TabelaCorridas& corridas, Escalonador& escalonador,
+                      DespachoSimulado& despacho, const ParametrosFase2& parametros, Arena& arena, Arena& rascunho) {
+    // Poucas chegadas por tempo: ordenação por inserção
+    for (int a = 1; a < despacho.num_chegadas; a++) {
+        int chegada = despacho.chegadas[a];
+        int b = a - 1;
+        while (b >= 0 && despacho.chegadas[b] > chegada) {
+            despacho.chegadas[b + 1] = despacho.chegadas[b];
+            b--;
+        }
+        despacho.chegadas[b + 1] = chegada;
+    }
+    
+    int inseridas = 0;
+    for (int a = 0; a < despacho.num_chegadas; a++) {
+        int individual = despacho.chegadas[a];
+        int demanda = despacho.demanda_por_corrida[individual];
+        rascunho.reiniciar();
+        InsercaoEscolhida escolha = buscarInsercaoAtiva(demandas, corridas, escalonador, despacho, demanda,
+                                                        parametros, rascunho);
+        
+        if (escolha.corrida != -1) {
+            Corrida* corrida_antiga = corridas.getCorrida(escolha.corrida);
+            Evento* pendente = escalonador.getEvento(corridas.getEventoPendente(escolha.corrida));
+            Corrida* nova_corrida = construirReplanejamento(demandas, corrida_antiga, pendente->getIndiceParada(),
+                                                            demanda, parametros.gama, arena);
+            confirmarInsercao(demandas, corridas, demanda, escolha, nova_corrida, parametros);
+            despacho.atualizarAtiva(nova_corrida, escolha.corrida, parametros.eta, true);
+            corridas.liberar(individual);
+            inseridas++;
+        } else {
+            Evento* partida = escalonador.criaEvento(despacho.tempo_chegadas, COLETA_PASSAGEIRO,
+                                                     corridas.getReferencia(individual), 0);
+            partida->setOrdemCorrida(individual);
+            corridas.vincularEvento(individual, escalonador.insereEvento(partida));
+        }
+    }
+    
+    despacho.total_chegadas += despacho.num_chegadas;
+    despacho.total_inseridas += inseridas;
+    despacho.num_chegadas = 0;
+    return inseridas;
+}
@@ -0,0 +1,67 @@
+#include "EntradaDemandas.hpp"
+#include "SimulacaoException.hpp"
+#include <iostream>
+#include <string>
+
+// Lê o próximo valor pelo leitor rápido ou, sem leitor, por std::cin
+bool lerValor(LeitorEntrada* leitor, int& valor) {
+    if (leitor != nullptr) {
+        return leitor->lerInteiro(valor);
+    }
+    return static_cast<bool>(std::cin >> valor);
+}
+
+bool lerValor(LeitorEntrada* leitor, double& valor) {
+    if (leitor != nullptr) {
+        return leitor->lerDecimal(valor);
+    }
+    return static_cast<bool>(std::cin >> valor);
+}
+
+void validarParametros(int eta, double gama, double delta, double alfa, double beta, double lambda) {
+    if (eta <= 0) {
+        throw ParametroInvalidoException("Capacidade do veiculo (eta) deve ser positiva");
+    }
+    if (gama <= 0.0) {
+        throw ParametroInvalidoException("Velocidade do veiculo (gama) deve ser positiva");
+    }
+    if (delta < 0.0) {
+        throw ParametroInvalidoException("Intervalo temporal (delta) nao pode ser negativo");
+    }
+    if (alfa < 0.0) {
+        throw ParametroInvalidoException("Distancia maxima entre origens (alfa) nao pode ser negativa");
+    }
+    if (beta < 0.0) {
+        throw ParametroInvalidoException("Distancia maxima entre destinos (beta) nao pode ser negativa");
+    }
+    if (lambda < 0.0 || lambda > 1.0) {
+        throw ParametroInvalidoException("Eficiencia minima (lambda) deve estar entre 0 e 1");
+    }
+}
+
+// Lê o cabeçalho da entrada: os seis parâmetros e o número de demandas
+void lerCabecalho(LeitorEntrada* leitor, int& eta, double& gama, double& delta, double& alfa, double& beta,
+                  double& lambda, int& num_demandas) {
+    if (!(lerValor(leitor, eta) && lerValor(leitor, gama) && lerValor(leitor, delta) &&
+          lerValor(leitor, alfa) && lerValor(leitor, beta) && lerValor(leitor, lambda) &&
+          lerValor(leitor, num_demandas))) {
+        throw ParametroInvalidoException("Parametros de entrada ausentes ou malformados");
+    }
+}
+
+void lerDemandas(LeitorEntrada* leitor, int num_demandas, DemandaStore& demandas) {
+    for (int i = 0; i < num_demandas; i++) {
+        int id;
+        double tempo, ox, oy, dx, dy;
+        if (!(lerValor(leitor, id) && lerValor(leitor, tempo) && lerValor(leitor, ox) &&
+              lerValor(leitor, oy) && lerValor(leitor, dx) && lerValor(leitor, dy))) {
+            std::string mensagem = "Demanda " + std::to_string(i) + " ausente ou malformada";
+            if (leitor != nullptr) {
+                mensagem += " (linha " + std::to_string(leitor->getLinha()) + ")";
+            }
+            throw DemandaInvalidaException(mensagem);
+        }
+        
+        demandas.adicionar(id, tempo, ox, oy, dx, dy);
+    }
+}
@@ -1,21 +1,33 @@
 #include "Escalonador.hpp"
 
+#define ESCALONADOR_TEXTO_(x) #x
+#define ESCALONADOR_TEXTO(x) ESCALONADOR_TEXTO_(x)
+
+static const int CAPACIDADE_INICIAL_HANDLES = 64;
+
 // ==================== CLASSE EVENTO ====================
 
 // Construtor padrão
 Evento::Evento() {
     this->tempo = 0.0;
     this->tipo = COLETA_PASSAGEIRO;
-    this->corrida_associada = nullptr;
+    this->corrida_associada.indice = -1;
+    this->corrida_associada.geracao = 0;
     this->indice_parada = 0;
+    this->ordem_corrida = -1;
+    this->posicao_fila = -1;
+    this->handle = -1;
 }
 
 // Construtor parametrizado
-Evento::Evento(double tempo, TipoEvento tipo, Corrida* corrida, int indice_parada) {
+Evento::Evento(double tempo, TipoEvento tipo, ReferenciaCorrida corrida, int indice_parada) {
     this->tempo = tempo;
     this->tipo = tipo;
     this->corrida_associada = corrida;
     this->indice_parada = indice_parada;
+    this->ordem_corrida = -1;
+    this->posicao_fila = -1;
+    this->handle = -1;
 }
 
 // Destrutor
@@ -32,7 +44,7 @@ TipoEvento Evento::getTipo() const {
     return this->tipo;
 }
 
-Corrida* Evento::getCorridaAssociada() const {
+ReferenciaCorrida Evento::getCorridaAssociada() const {
     return this->corrida_associada;
 }
 
@@ -40,6 +52,18 @@ int Evento::getIndiceParada() const {
     return this->indice_parada;
 }
 
+int Evento::getOrdemCorrida() const {
+    return this->ordem_corrida;
+}
+
+int Evento::getPosicaoFila() const {
+    return this->posicao_fila;
+}
+
+int Evento::getHandle() const {
+    return this->handle;
+}
+
 // Setters
 void Evento::setTempo(double tempo) {
     this->tempo = tempo;
@@ -49,7 +73,7 @@ void Evento::setTipo(TipoEvento tipo) {
     this->tipo = tipo;
 }
 
-void Evento::setCorridaAssociada(Corrida* corrida) {
+void Evento::setCorridaAssociada(ReferenciaCorrida corrida) {
     this->corrida_associada = corrida;
 }
 
@@ -57,6 +81,18 @@ void Evento::setIndiceParada(int indice) {
     this->indice_parada = indice;
 }
 
+void Evento::setOrdemCorrida(int ordem) {
+    this->ordem_corrida = ordem;
+}
+
+void Evento::setPosicaoFila(int posicao) {
+    this->posicao_fila = posicao;
+}
+
+void Evento::setHandle(int handle) {
+    this->handle = handle;
+}
+
 // Operador de comparação para o heap
 bool Evento::operator>(const Evento& outro) const {
     return this->tempo > outro.tempo;
@@ -65,90 +101,196 @@ bool Evento::operator>(const Evento& outro) const {
 // ==================== CLASSE ESCALONADOR ====================
 
 // Construtor padrão
-Escalonador::Escalonador() {
-    this->capacidade = 100;
-    this->heap = new Evento*[this->capacidade];
-    this->tamanho = 0;
+Escalonador::Escalonador() : fila(100) {
+    this->calendario = nullptr;
+    this->arena_eventos = nullptr;
     this->total_eventos_processados = 0;
     this->total_eventos_inseridos = 0;
+    this->total_eventos_em_lote = 0;
+    this->total_eventos_atualizados = 0;
+    this->total_eventos_removidos = 0;
+    inicializarHandles(100);
 }
 
 // Construtor parametrizado
-Escalonador::Escalonador(int capacidade_inicial) {
-    this->capacidade = capacidade_inicial;
-    this->heap = new Evento*[this->capacidade];
-    this->tamanho = 0;
+Escalonador::Escalonador(int capacidade_inicial) : Escalonador(capacidade_inicial, nullptr) {
+}
+
+// Construtor com arena: os eventos pertencem à arena e não são deletados aqui
+Escalonador::Escalonador(int capacidade_inicial, Arena* arena_eventos)
+    : Escalonador(capacidade_inicial, arena_eventos, FILA_HEAP) {
+}
+
+// Construtor com a fila escolhida em tempo de execução
+Escalonador::Escalonador(int capacidade_inicial, Arena* arena_eventos, TipoFilaEventos tipo_fila)
+    : fila(tipo_fila == FILA_HEAP ? capacidade_inicial : 1) {
+    this->calendario = nullptr;
+    if (tipo_fila == FILA_CALENDARIO) {
+        this->calendario = new FilaCalendario(capacidade_inicial);
+    }
+    this->arena_eventos = arena_eventos;
     this->total_eventos_processados = 0;
     this->total_eventos_inseridos = 0;
+    this->total_eventos_em_lote = 0;
+    this->total_eventos_atualizados = 0;
+    this->total_eventos_removidos = 0;
+    inicializarHandles(capacidade_inicial);
 }
 
 // Destrutor
 Escalonador::~Escalonador() {
     // Deletar eventos restantes
-    for (int i = 0; i < this->tamanho; i++) {
-        delete this->heap[i];
-    }
-    delete[] this->heap;
+    descartarEventos();
+    delete this->calendario;
+    delete[] this->eventos_handle;
+    delete[] this->geracoes_handle;
+    delete[] this->handles_livres;
 }
 
 // Operações principais
+// Eventos ainda na fila são esquecidos (não voltam ao pool), e seus
+// handles deixam de valer
 void Escalonador::inicializa() {
-    this->tamanho = 0;
+    if (this->calendario != nullptr) {
+        this->calendario->limpar();
+    }
+    this->fila.limpar();
+    for (int h = 0; h < this->num_handles; h++) {
+        if (this->eventos_handle[h] != nullptr) {
+            this->eventos_handle[h] = nullptr;
+            this->geracoes_handle[h]++;
+            this->handles_livres[this->num_handles_livres++] = h;
+        }
+    }
     this->total_eventos_processados = 0;
     this->total_eventos_inseridos = 0;
+    this->total_eventos_em_lote = 0;
+    this->total_eventos_atualizados = 0;
+    this->total_eventos_removidos = 0;
 }
 
-void Escalonador::insereEvento(Evento* evento) {
-    if (this->tamanho >= this->capacidade) {
-        redimensionar();
+HandleEvento Escalonador::insereEvento(Evento* evento) {
+    registrarHandle(evento);
+    if (this->calendario != nullptr) {
+        this->calendario->inserir(evento);
+    } else {
+        this->fila.inserir(evento);
     }
-    
-    this->heap[this->tamanho] = evento;
-    heapifyUp(this->tamanho);
-    this->tamanho++;
     this->total_eventos_inseridos++;
+    return getHandle(evento);
+}
+
+// Cria o evento no pool do escalonador; deve voltar com liberaEvento()
+HandleEvento Escalonador::insereEvento(double tempo, TipoEvento tipo, ReferenciaCorrida corrida, int indice_parada) {
+    return insereEvento(criaEvento(tempo, tipo, corrida, indice_parada));
+}
+
+// Carga em lote: o heap é refeito uma única vez (Floyd) em vez de uma
+// subida por evento
+void Escalonador::insereLote(Evento* const* eventos, int quantidade) {
+    for (int i = 0; i < quantidade; i++) {
+        registrarHandle(eventos[i]);
+    }
+    if (this->calendario != nullptr) {
+        this->calendario->inserirLote(eventos, quantidade);
+    } else {
+        this->fila.inserirLote(eventos, quantidade);
+    }
+    this->total_eventos_inseridos += quantidade;
+    this->total_eventos_em_lote += quantidade;
+}
+
+// Evento do pool ainda fora da fila (para montar lotes)
+Evento* Escalonador::criaEvento(double tempo, TipoEvento tipo, ReferenciaCorrida corrida, int indice_parada) {
+    return this->pool.criar(Evento(tempo, tipo, corrida, indice_parada));
 }
 
 Evento* Escalonador::retiraProximoEvento() {
-    if (this->tamanho == 0) {
+    Evento* evento_minimo = retirarDaFila();
+    if (evento_minimo != nullptr) {
+        this->total_eventos_processados++;
+    }
+    return evento_minimo;
+}
+
+// Muda o tempo de um evento que ainda está na fila, sem retirá-lo
+bool Escalonador::atualizaEvento(HandleEvento handle, double novo_tempo) {
+    Evento* evento = getEvento(handle);
+    if (evento == nullptr) {
+        return false;
+    }
+    evento->setTempo(novo_tempo);
+    if (this->calendario != nullptr) {
+        this->calendario->atualizar(evento);
+    } else {
+        this->fila.atualizar(evento);
+    }
+    this->total_eventos_atualizados++;
+    return true;
+}
+
+// Tira da fila um evento que ainda não foi processado
+Evento* Escalonador::removeEvento(HandleEvento handle) {
+    Evento* evento = getEvento(handle);
+    if (evento == nullptr) {
         return nullptr;
     }
-    
-    Evento* evento_minimo = this->heap[0];
-    this->tamanho--;
-    
-    if (this->tamanho > 0) {
-        this->heap[0] = this->heap[this->tamanho];
-        heapifyDown(0);
+    if (this->calendario != nullptr) {
+        this->calendario->remover(evento);
+    } else {
+        this->fila.remover(evento);
     }
-    
-    this->total_eventos_processados++;
-    return evento_minimo;
+    liberarHandle(evento);
+    this->total_eventos_removidos++;
+    return evento;
+}
+
+HandleEvento Escalonador::getHandle(const Evento* evento) const {
+    HandleEvento handle;
+    handle.indice = evento->getHandle();
+    handle.geracao = handle.indice >= 0 ? this->geracoes_handle[handle.indice] : 0;
+    return handle;
+}
+
+Evento* Escalonador::getEvento(HandleEvento handle) const {
+    if (handle.indice < 0 || handle.indice >= this->num_handles ||
+        this->geracoes_handle[handle.indice] != handle.geracao) {
+        return nullptr;
+    }
+    return this->eventos_handle[handle.indice];
+}
+
+// Devolve ao pool um evento retirado que foi criado pelo escalonador
+void Escalonador::liberaEvento(Evento* evento) {
+    this->pool.liberar(evento);
 }
 
 void Escalonador::finaliza() {
     // Gerar estatísticas de escalonamento
     // Por enquanto, apenas limpar eventos restantes
-    for (int i = 0; i < this->tamanho; i++) {
-        delete this->heap[i];
-    }
-    this->tamanho = 0;
+    descartarEventos();
 }
 
 // Métodos auxiliares
 bool Escalonador::estaVazio() const {
-    return this->tamanho == 0;
+    return getTamanho() == 0;
 }
 
 int Escalonador::getTamanho() const {
-    return this->tamanho;
+    if (this->calendario != nullptr) {
+        return this->calendario->getTamanho();
+    }
+    return this->fila.getTamanho();
 }
 
 double Escalonador::getTempoProximoEvento() const {
-    if (this->tamanho == 0) {
+    if (getTamanho() == 0) {
         return -1.0;
     }
-    return this->heap[0]->getTempo();
+    if (this->calendario != nullptr) {
+        return this->calendario->getTempoMinimo();
+    }
+    return this->fila.getTempoMinimo();
 }
 
 // Estatísticas
@@ -160,68 +302,106 @@ int Escalonador::getTotalEventosInseridos() const {
     return this->total_eventos_inseridos;
 }
 
-// Métodos privados do heap
-void Escalonador::heapifyUp(int indice) {
-    while (indice > 0) {
-        int pai = getPai(indice);
-        if (*this->heap[indice] > *this->heap[pai]) {
-            break;
-        }
-        trocar(indice, pai);
-        indice = pai;
-    }
+int Escalonador::getTotalEventosEmLote() const {
+    return this->total_eventos_em_lote;
 }
 
-void Escalonador::heapifyDown(int indice) {
-    while (true) {
-        int menor = indice;
-        int esquerdo = getFilhoEsquerdo(indice);
-        int direito = getFilhoDireito(indice);
-        
-        if (esquerdo < this->tamanho && *this->heap[esquerdo] > *this->heap[menor]) {
-            menor = esquerdo;
-        }
-        
-        if (direito < this->tamanho && *this->heap[direito] > *this->heap[menor]) {
-            menor = direito;
-        }
-        
-        if (menor == indice) {
-            break;
-        }
-        
-        trocar(indice, menor);
-        indice = menor;
+int Escalonador::getTotalEventosAtualizados() const {
+    return this->total_eventos_atualizados;
+}
+
+int Escalonador::getTotalEventosRemovidos() const {
+    return this->total_eventos_removidos;
+}
+
+const char* Escalonador::getNomeFila() const {
+    if (this->calendario != nullptr) {
+        return "calendario";
     }
+#ifdef ESCALONADOR_HEAP_DARIO
+    return "heap " ESCALONADOR_TEXTO(ARIDADE_HEAP) "-ario";
+#else
+    return "heap binario";
+#endif
+}
+
+const EventoPool& Escalonador::getPool() const {
+    return this->pool;
 }
 
-void Escalonador::redimensionar() {
-    int nova_capacidade = this->capacidade * 2;
-    Evento** novo_heap = new Evento*[nova_capacidade];
-    
-    for (int i = 0; i < this->tamanho; i++) {
-        novo_heap[i] = this->heap[i];
+const FilaCalendario* Escalonador::getCalendario() const {
+    return this->calendario;
+}
+
+// Métodos privados
+Evento* Escalonador::retirarDaFila() {
+    Evento* evento;
+    if (this->calendario != nullptr) {
+        evento = this->calendario->retirarMinimo();
+    } else {
+        evento = this->fila.retirarMinimo();
     }
-    
-    delete[] this->heap;
-    this->heap = novo_heap;
-    this->capacidade = nova_capacidade;
+    if (evento != nullptr) {
+        liberarHandle(evento);
+    }
+    return evento;
 }
 
-int Escalonador::getPai(int indice) const {
-    return (indice - 1) / 2;
+void Escalonador::descartarEventos() {
+    Evento* evento;
+    while ((evento = retirarDaFila()) != nullptr) {
+        if (this->pool.contem(evento)) {
+            this->pool.liberar(evento);
+        } else if (this->arena_eventos == nullptr) {
+            delete evento;
+        }
+        // Eventos da arena são liberados junto com ela
+    }
 }
 
-int Escalonador::getFilhoEsquerdo(int indice) const {
-    return 2 * indice + 1;
+void Escalonador::inicializarHandles(int capacidade) {
+    this->capacidade_handles = capacidade > CAPACIDADE_INICIAL_HANDLES ? capacidade : CAPACIDADE_INICIAL_HANDLES;
+    this->eventos_handle = new Evento*[this->capacidade_handles];
+    this->geracoes_handle = new unsigned int[this->capacidade_handles];
+    this->handles_livres = new int[this->capacidade_handles];
+    this->num_handles = 0;
+    this->num_handles_livres = 0;
 }
 
-int Escalonador::getFilhoDireito(int indice) const {
-    return 2 * indice + 2;
+// Entradas liberadas são reaproveitadas primeiro, de modo que a tabela
+// acompanha o pico de eventos na fila
+void Escalonador::registrarHandle(Evento* evento) {
+    int indice;
+    if (this->num_handles_livres > 0) {
+        indice = this->handles_livres[--this->num_handles_livres];
+    } else {
+        if (this->num_handles == this->capacidade_handles) {
+            int nova_capacidade = 2 * this->capacidade_handles;
+            Evento** novos_eventos = new Evento*[nova_capacidade];
+            unsigned int* novas_geracoes = new unsigned int[nova_capacidade];
+            for (int h = 0; h < this->num_handles; h++) {
+                novos_eventos[h] = this->eventos_handle[h];
+                novas_geracoes[h] = this->geracoes_handle[h];
+            }
+            delete[] this->eventos_handle;
+            delete[] this->geracoes_handle;
+            delete[] this->handles_livres;
+            this->eventos_handle = novos_eventos;
+            this->geracoes_handle = novas_geracoes;
+            this->handles_livres = new int[nova_capacidade];
+            this->capacidade_handles = nova_capacidade;
+        }
+        indice = this->num_handles++;
+        this->geracoes_handle[indice] = 0;
+    }
+    this->eventos_handle[indice] = evento;
+    evento->setHandle(indice);
 }
 
-void Escalonador::trocar(int indice1, int indice2) {
-    Evento* temp = this->heap[indice1];
-    this->heap[indice1] = this->heap[indice2];
-    this->heap[indice2] = temp;
-}
\ No newline at end of file
+void Escalonador::liberarHandle(Evento* evento) {
+    int indice = evento->getHandle();
+    this->eventos_handle[indice] = nullptr;
+    this->geracoes_handle[indice]++;
+    this->handles_livres[this->num_handles_livres++] = indice;
+    evento->setHandle(-1);
+}
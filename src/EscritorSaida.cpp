@@ -0,0 +1,156 @@
+#include "EscritorSaida.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+// Maior texto de um long long com sinal
+static const size_t TAMANHO_INTEIRO = 20;
+
+// Escreve os dígitos de valor a partir de destino; retorna o número de dígitos
+static int escreverDigitos(unsigned long long valor, char* destino) {
+    char invertido[20];
+    int tamanho = 0;
+    do {
+        invertido[tamanho++] = static_cast<char>('0' + valor % 10);
+        valor /= 10;
+    } while (valor != 0);
+
+    for (int i = 0; i < tamanho; i++) {
+        destino[i] = invertido[tamanho - 1 - i];
+    }
+    return tamanho;
+}
+
+// Construtor
+EscritorSaida::EscritorSaida(std::ostream& destino, size_t capacidade) : destino(destino) {
+    this->capacidade = capacidade > TAMANHO_MAXIMO_DECIMAL ? capacidade : TAMANHO_MAXIMO_DECIMAL;
+    this->buffer = new char[this->capacidade];
+    this->usado = 0;
+    this->bytes_escritos = 0;
+    this->descargas = 0;
+}
+
+// Destrutor
+EscritorSaida::~EscritorSaida() {
+    descarregar();
+    delete[] this->buffer;
+}
+
+// Operações principais
+void EscritorSaida::escreverCaractere(char caractere) {
+    reservar(1);
+    this->buffer[this->usado++] = caractere;
+}
+
+void EscritorSaida::escreverTexto(const char* texto) {
+    escreverBytes(texto, strlen(texto));
+}
+
+void EscritorSaida::escreverBytes(const void* bytes, size_t tamanho) {
+    if (tamanho > this->capacidade) {
+        descarregar();
+        this->destino.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(tamanho));
+        this->bytes_escritos += tamanho;
+        return;
+    }
+    reservar(tamanho);
+    memcpy(this->buffer + this->usado, bytes, tamanho);
+    this->usado += tamanho;
+}
+
+void EscritorSaida::escreverInteiro(long long valor) {
+    reservar(TAMANHO_INTEIRO);
+    unsigned long long magnitude = static_cast<unsigned long long>(valor);
+    if (valor < 0) {
+        this->buffer[this->usado++] = '-';
+        magnitude = 0ULL - magnitude;
+    }
+    this->usado += escreverDigitos(magnitude, this->buffer + this->usado);
+}
+
+void EscritorSaida::escreverDecimal2(double valor) {
+    reservar(TAMANHO_MAXIMO_DECIMAL);
+    this->usado += formatarDecimal2(valor, this->buffer + this->usado);
+}
+
+void EscritorSaida::descarregar() {
+    if (this->usado == 0) {
+        return;
+    }
+    this->destino.write(this->buffer, static_cast<std::streamsize>(this->usado));
+    this->destino.flush();
+    this->bytes_escritos += this->usado;
+    this->descargas++;
+    this->usado = 0;
+}
+
+// valor = m * 2^e; valor * 100 = (100 m) * 2^e com 100 m < 2^60, então a
+// parte inteira e o resto da divisão por 2^-e são exatos em 64 bits
+int EscritorSaida::formatarDecimal2(double valor, char* destino) {
+    uint64_t bits;
+    memcpy(&bits, &valor, sizeof(bits));
+    bool negativo = (bits >> 63) != 0;
+    int expoente_bruto = static_cast<int>((bits >> 52) & 0x7FF);
+    uint64_t fracao = bits & ((1ULL << 52) - 1);
+
+    uint64_t mantissa;
+    int expoente;
+    if (expoente_bruto == 0) {
+        mantissa = fracao;
+        expoente = -1074;
+    } else {
+        mantissa = fracao | (1ULL << 52);
+        expoente = expoente_bruto - 1075;
+    }
+
+    // Infinitos, NaN e valores a partir de 2^53, cujos centésimos não cabem
+    // em 64 bits
+    if (expoente_bruto == 0x7FF || expoente > 0) {
+        return snprintf(destino, TAMANHO_MAXIMO_DECIMAL, "%.2f", valor);
+    }
+
+    uint64_t centesimos;
+    if (expoente == 0) {
+        centesimos = mantissa * 100;
+    } else {
+        int deslocamento = -expoente;
+        uint64_t produto = mantissa * 100;
+        if (deslocamento >= 62) {
+            // produto < 2^60 fica abaixo da metade de 2^deslocamento
+            centesimos = 0;
+        } else {
+            centesimos = produto >> deslocamento;
+            uint64_t resto = produto & ((1ULL << deslocamento) - 1);
+            uint64_t metade = 1ULL << (deslocamento - 1);
+            if (resto > metade || (resto == metade && (centesimos & 1) != 0)) {
+                centesimos++;
+            }
+        }
+    }
+
+    int tamanho = 0;
+    if (negativo) {
+        destino[tamanho++] = '-';
+    }
+    tamanho += escreverDigitos(centesimos / 100, destino + tamanho);
+    destino[tamanho++] = '.';
+    destino[tamanho++] = static_cast<char>('0' + (centesimos / 10) % 10);
+    destino[tamanho++] = static_cast<char>('0' + centesimos % 10);
+    return tamanho;
+}
+
+// Estatísticas
+unsigned long long EscritorSaida::getBytesEscritos() const {
+    return this->bytes_escritos;
+}
+
+unsigned long long EscritorSaida::getDescargas() const {
+    return this->descargas;
+}
+
+// Métodos privados
+void EscritorSaida::reservar(size_t bytes) {
+    if (this->usado + bytes > this->capacidade) {
+        descarregar();
+    }
+}
@@ -0,0 +1,126 @@
+#include "EventoPool.hpp"
+#include "Escalonador.hpp"
+#include <cstddef>
+#include <new>
+
+// Eventos por bloco: 4096 eventos de 32 bytes ocupam 128 KiB
+static const int EVENTOS_POR_SLAB_PADRAO = 4096;
+
+static_assert(sizeof(Evento) >= sizeof(void*), "Evento deve comportar o ponteiro da lista livre");
+
+// Alinhamento do início dos eventos dentro de cada bloco
+static const size_t ALINHAMENTO_EVENTOS = alignof(std::max_align_t);
+
+// Construtor padrão
+EventoPool::EventoPool() : EventoPool(EVENTOS_POR_SLAB_PADRAO) {
+}
+
+// Construtor parametrizado
+EventoPool::EventoPool(int eventos_por_slab) {
+    this->slabs = nullptr;
+    this->livres = nullptr;
+    this->eventos_por_slab = eventos_por_slab > 0 ? eventos_por_slab : 1;
+    this->eventos_criados = 0;
+    this->eventos_reciclados = 0;
+    this->eventos_vivos = 0;
+    this->pico_vivos = 0;
+    this->total_slabs = 0;
+}
+
+// Destrutor
+EventoPool::~EventoPool() {
+    Slab* slab = this->slabs;
+    while (slab != nullptr) {
+        Slab* proximo = slab->proximo;
+        ::operator delete(slab);
+        slab = proximo;
+    }
+}
+
+// Operações principais
+Evento* EventoPool::criar(const Evento& modelo) {
+    void* memoria;
+    if (this->livres != nullptr) {
+        memoria = this->livres;
+        this->livres = this->livres->proximo;
+        this->eventos_reciclados++;
+    } else {
+        if (this->slabs == nullptr || this->slabs->usados == this->eventos_por_slab) {
+            Slab* slab = static_cast<Slab*>(::operator new(bytesSlab()));
+            slab->proximo = this->slabs;
+            slab->usados = 0;
+            this->slabs = slab;
+            this->total_slabs++;
+        }
+        memoria = dadosSlab(this->slabs) + static_cast<size_t>(this->slabs->usados) * sizeof(Evento);
+        this->slabs->usados++;
+    }
+
+    this->eventos_criados++;
+    this->eventos_vivos++;
+    if (this->eventos_vivos > this->pico_vivos) {
+        this->pico_vivos = this->eventos_vivos;
+    }
+    return new (memoria) Evento(modelo);
+}
+
+void EventoPool::liberar(Evento* evento) {
+    if (evento == nullptr) {
+        return;
+    }
+    evento->~Evento();
+    NoLivre* no = reinterpret_cast<NoLivre*>(evento);
+    no->proximo = this->livres;
+    this->livres = no;
+    this->eventos_vivos--;
+}
+
+// Percorre os blocos: usado apenas ao descartar eventos restantes
+bool EventoPool::contem(const Evento* evento) const {
+    const char* endereco = reinterpret_cast<const char*>(evento);
+    for (Slab* slab = this->slabs; slab != nullptr; slab = slab->proximo) {
+        const char* inicio = dadosSlab(slab);
+        if (endereco >= inicio && endereco < inicio + static_cast<size_t>(slab->usados) * sizeof(Evento)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Estatísticas
+long long EventoPool::getEventosCriados() const {
+    return this->eventos_criados;
+}
+
+long long EventoPool::getEventosReciclados() const {
+    return this->eventos_reciclados;
+}
+
+long long EventoPool::getEventosVivos() const {
+    return this->eventos_vivos;
+}
+
+long long EventoPool::getPicoVivos() const {
+    return this->pico_vivos;
+}
+
+int EventoPool::getTotalSlabs() const {
+    return this->total_slabs;
+}
+
+size_t EventoPool::getBytesReservados() const {
+    return static_cast<size_t>(this->total_slabs) * bytesSlab();
+}
+
+// Métodos privados
+size_t EventoPool::tamanhoCabecalho() {
+    return (sizeof(Slab) + ALINHAMENTO_EVENTOS - 1) / ALINHAMENTO_EVENTOS * ALINHAMENTO_EVENTOS;
+}
+
+char* EventoPool::dadosSlab(Slab* slab) const {
+    return reinterpret_cast<char*>(slab) + tamanhoCabecalho();
+}
+
+size_t EventoPool::bytesSlab() const {
+    return tamanhoCabecalho() + static_cast<size_t>(this->eventos_por_slab) * sizeof(Evento);
+}
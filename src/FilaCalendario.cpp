@@ -0,0 +1,336 @@
+#include "FilaCalendario.hpp"
+#include "Escalonador.hpp"
+#include <cmath>
+
+static const int BALDES_MINIMOS = 2;
+static const double LARGURA_INICIAL = 1.0;
+
+// Eventos mais próximos usados para estimar a largura dos dias
+static const int TAMANHO_AMOSTRA = 25;
+
+// Dias são saturados neste valor (2^62) para caberem em long long
+static const double DIA_MAXIMO = 4611686018427387904.0;
+
+// Construtor
+FilaCalendario::FilaCalendario(int capacidade_inicial) {
+    this->capacidade = capacidade_inicial > 0 ? capacidade_inicial : 1;
+    this->tempos = new double[this->capacidade];
+    this->dias = new long long[this->capacidade];
+    this->eventos = new Evento*[this->capacidade];
+    this->proximos = new int[this->capacidade];
+
+    this->num_baldes = BALDES_MINIMOS;
+    this->cabecas = new int[this->num_baldes];
+    this->largura = LARGURA_INICIAL;
+    this->redimensionamentos = 0;
+    this->buscas_diretas = 0;
+
+    limpar();
+}
+
+// Destrutor
+FilaCalendario::~FilaCalendario() {
+    delete[] this->tempos;
+    delete[] this->dias;
+    delete[] this->eventos;
+    delete[] this->proximos;
+    delete[] this->cabecas;
+}
+
+// Operações principais
+void FilaCalendario::inserir(Evento* evento) {
+    if (this->livre == -1) {
+        crescerEntradas();
+    }
+
+    int entrada = this->livre;
+    this->livre = this->proximos[entrada];
+    this->tempos[entrada] = evento->getTempo();
+    this->dias[entrada] = calcularDia(this->tempos[entrada]);
+    this->eventos[entrada] = evento;
+    evento->setPosicaoFila(entrada);
+
+    // Um evento anterior ao dia atual (ou o primeiro) reposiciona a busca
+    if (this->tamanho == 0 || this->dias[entrada] < this->dia_atual) {
+        this->dia_atual = this->dias[entrada];
+    }
+    encadearOrdenado(entrada);
+    this->tamanho++;
+
+    if (this->tamanho > 2 * this->num_baldes) {
+        redimensionar(2 * this->num_baldes);
+    }
+}
+
+// A inserção já é O(1) amortizada: o lote só evita a chamada por evento
+void FilaCalendario::inserirLote(Evento* const* eventos, int quantidade) {
+    for (int i = 0; i < quantidade; i++) {
+        inserir(eventos[i]);
+    }
+}
+
+Evento* FilaCalendario::retirarMinimo() {
+    if (this->tamanho == 0) {
+        return nullptr;
+    }
+
+    bool busca_direta = false;
+    int entrada = localizarMinimo(busca_direta);
+    if (busca_direta) {
+        this->buscas_diretas++;
+    }
+
+    // O mínimo é sempre a cabeça do seu balde
+    this->dia_atual = this->dias[entrada];
+    this->cabecas[calcularBalde(this->dia_atual)] = this->proximos[entrada];
+
+    Evento* evento = this->eventos[entrada];
+    evento->setPosicaoFila(-1);
+    this->proximos[entrada] = this->livre;
+    this->livre = entrada;
+    this->tamanho--;
+
+    if (this->num_baldes > BALDES_MINIMOS && this->tamanho < this->num_baldes / 2) {
+        redimensionar(this->num_baldes / 2);
+    }
+    return evento;
+}
+
+// Reencadeia a entrada com o novo tempo; a inserção (re)posiciona o dia
+// atual, e um empate passa a sair depois dos que já estavam na fila
+void FilaCalendario::atualizar(Evento* evento) {
+    int entrada = evento->getPosicaoFila();
+    desencadear(entrada);
+    this->tempos[entrada] = evento->getTempo();
+    this->dias[entrada] = calcularDia(this->tempos[entrada]);
+    if (this->dias[entrada] < this->dia_atual) {
+        this->dia_atual = this->dias[entrada];
+    }
+    encadearOrdenado(entrada);
+}
+
+void FilaCalendario::remover(Evento* evento) {
+    int entrada = evento->getPosicaoFila();
+    evento->setPosicaoFila(-1);
+    desencadear(entrada);
+    this->proximos[entrada] = this->livre;
+    this->livre = entrada;
+    this->tamanho--;
+
+    if (this->num_baldes > BALDES_MINIMOS && this->tamanho < this->num_baldes / 2) {
+        redimensionar(this->num_baldes / 2);
+    }
+}
+
+void FilaCalendario::limpar() {
+    for (int b = 0; b < this->num_baldes; b++) {
+        this->cabecas[b] = -1;
+    }
+    for (int i = 0; i < this->capacidade - 1; i++) {
+        this->proximos[i] = i + 1;
+    }
+    this->proximos[this->capacidade - 1] = -1;
+    this->livre = 0;
+    this->dia_atual = 0;
+    this->tamanho = 0;
+}
+
+// Getters
+int FilaCalendario::getTamanho() const {
+    return this->tamanho;
+}
+
+double FilaCalendario::getTempoMinimo() const {
+    bool busca_direta = false;
+    return this->tempos[localizarMinimo(busca_direta)];
+}
+
+int FilaCalendario::getNumBaldes() const {
+    return this->num_baldes;
+}
+
+double FilaCalendario::getLargura() const {
+    return this->largura;
+}
+
+int FilaCalendario::getRedimensionamentos() const {
+    return this->redimensionamentos;
+}
+
+int FilaCalendario::getBuscasDiretas() const {
+    return this->buscas_diretas;
+}
+
+// Métodos privados
+long long FilaCalendario::calcularDia(double tempo) const {
+    double dia = floor(tempo / this->largura);
+    if (std::isnan(dia) || dia > DIA_MAXIMO) {
+        return static_cast<long long>(DIA_MAXIMO);
+    }
+    if (dia < -DIA_MAXIMO) {
+        return static_cast<long long>(-DIA_MAXIMO);
+    }
+    return static_cast<long long>(dia);
+}
+
+int FilaCalendario::calcularBalde(long long dia) const {
+    return static_cast<int>(static_cast<unsigned long long>(dia) & static_cast<unsigned long long>(this->num_baldes - 1));
+}
+
+// Insere depois das entradas de dia menor e das de mesmo tempo, mantendo a
+// cabeça de cada balde no menor dia e os empates em ordem de chegada
+void FilaCalendario::encadearOrdenado(int entrada) {
+    long long dia = this->dias[entrada];
+    double tempo = this->tempos[entrada];
+    int* ligacao = &this->cabecas[calcularBalde(dia)];
+
+    while (*ligacao != -1 &&
+           (this->dias[*ligacao] < dia || (this->dias[*ligacao] == dia && !(tempo < this->tempos[*ligacao])))) {
+        ligacao = &this->proximos[*ligacao];
+    }
+    this->proximos[entrada] = *ligacao;
+    *ligacao = entrada;
+}
+
+void FilaCalendario::desencadear(int entrada) {
+    int* ligacao = &this->cabecas[calcularBalde(this->dias[entrada])];
+    while (*ligacao != entrada) {
+        ligacao = &this->proximos[*ligacao];
+    }
+    *ligacao = this->proximos[entrada];
+}
+
+// Percorre um "ano" (num_baldes dias) a partir do dia atual; se nenhum balde
+// tiver evento do dia visitado, recorre à busca direta entre as cabeças
+int FilaCalendario::localizarMinimo(bool& busca_direta) const {
+    for (int k = 0; k < this->num_baldes; k++) {
+        long long dia = this->dia_atual + k;
+        int cabeca = this->cabecas[calcularBalde(dia)];
+        if (cabeca != -1 && this->dias[cabeca] <= dia) {
+            return cabeca;
+        }
+    }
+
+    busca_direta = true;
+    int minimo = -1;
+    for (int b = 0; b < this->num_baldes; b++) {
+        int cabeca = this->cabecas[b];
+        if (cabeca == -1) {
+            continue;
+        }
+        if (minimo == -1 || this->dias[cabeca] < this->dias[minimo] ||
+            (this->dias[cabeca] == this->dias[minimo] && this->tempos[cabeca] < this->tempos[minimo])) {
+            minimo = cabeca;
+        }
+    }
+    return minimo;
+}
+
+// Regra de Brown: separação média entre os eventos mais próximos,
+// recalculada sem as separações acima do dobro da média, vezes 3
+double FilaCalendario::estimarLargura() const {
+    double amostra[TAMANHO_AMOSTRA];
+    int tamanho_amostra = 0;
+
+    for (int b = 0; b < this->num_baldes; b++) {
+        for (int e = this->cabecas[b]; e != -1; e = this->proximos[e]) {
+            double tempo = this->tempos[e];
+            if (!std::isfinite(tempo)) {
+                continue;
+            }
+            if (tamanho_amostra == TAMANHO_AMOSTRA && !(tempo < amostra[TAMANHO_AMOSTRA - 1])) {
+                continue;
+            }
+
+            int posicao = tamanho_amostra < TAMANHO_AMOSTRA ? tamanho_amostra++ : TAMANHO_AMOSTRA - 1;
+            while (posicao > 0 && amostra[posicao - 1] > tempo) {
+                amostra[posicao] = amostra[posicao - 1];
+                posicao--;
+            }
+            amostra[posicao] = tempo;
+        }
+    }
+
+    if (tamanho_amostra < 2) {
+        return this->largura;
+    }
+
+    double media = (amostra[tamanho_amostra - 1] - amostra[0]) / (tamanho_amostra - 1);
+    double soma = 0.0;
+    int separacoes = 0;
+    for (int i = 1; i < tamanho_amostra; i++) {
+        double separacao = amostra[i] - amostra[i - 1];
+        if (separacao <= 2.0 * media) {
+            soma += separacao;
+            separacoes++;
+        }
+    }
+
+    double nova_largura = separacoes > 0 ? 3.0 * soma / separacoes : 0.0;
+    if (!(nova_largura > 0.0) || !std::isfinite(nova_largura)) {
+        return this->largura;
+    }
+    return nova_largura;
+}
+
+void FilaCalendario::redimensionar(int novo_num_baldes) {
+    double nova_largura = estimarLargura();
+    int* cabecas_antigas = this->cabecas;
+    int num_baldes_antigo = this->num_baldes;
+
+    this->num_baldes = novo_num_baldes;
+    this->largura = nova_largura;
+    this->cabecas = new int[this->num_baldes];
+    for (int b = 0; b < this->num_baldes; b++) {
+        this->cabecas[b] = -1;
+    }
+
+    // Percorrer cada balde antigo em ordem preserva a ordem dos empates
+    bool primeiro = true;
+    for (int b = 0; b < num_baldes_antigo; b++) {
+        int e = cabecas_antigas[b];
+        while (e != -1) {
+            int proximo = this->proximos[e];
+            this->dias[e] = calcularDia(this->tempos[e]);
+            if (primeiro || this->dias[e] < this->dia_atual) {
+                this->dia_atual = this->dias[e];
+                primeiro = false;
+            }
+            encadearOrdenado(e);
+            e = proximo;
+        }
+    }
+
+    delete[] cabecas_antigas;
+    this->redimensionamentos++;
+}
+
+void FilaCalendario::crescerEntradas() {
+    int nova_capacidade = this->capacidade * 2;
+    double* novos_tempos = new double[nova_capacidade];
+    long long* novos_dias = new long long[nova_capacidade];
+    Evento** novos_eventos = new Evento*[nova_capacidade];
+    int* novos_proximos = new int[nova_capacidade];
+
+    for (int i = 0; i < this->capacidade; i++) {
+        novos_tempos[i] = this->tempos[i];
+        novos_dias[i] = this->dias[i];
+        novos_eventos[i] = this->eventos[i];
+        novos_proximos[i] = this->proximos[i];
+    }
+    for (int i = this->capacidade; i < nova_capacidade - 1; i++) {
+        novos_proximos[i] = i + 1;
+    }
+    novos_proximos[nova_capacidade - 1] = -1;
+
+    delete[] this->tempos;
+    delete[] this->dias;
+    delete[] this->eventos;
+    delete[] this->proximos;
+    this->tempos = novos_tempos;
+    this->dias = novos_dias;
+    this->eventos = novos_eventos;
+    this->proximos = novos_proximos;
+    this->livre = this->capacidade;
+    this->capacidade = nova_capacidade;
+}
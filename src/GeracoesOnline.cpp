@@ -0,0 +1,119 @@
+#include "GeracoesOnline.hpp"
+
+// Construtor
+GeracoesOnline::GeracoesOnline() {
+    this->capacidade = 4;
+    this->geracoes = new GeracaoCorridas[this->capacidade];
+    this->livres = new int[this->capacidade];
+    this->num_geracoes = 0;
+    this->num_livres = 0;
+    this->atual = -1;
+    this->corridas_atual = 0;
+    this->pico_em_uso = 0;
+    this->capacidade_corridas = CORRIDAS_POR_GERACAO;
+    this->geracao_por_corrida = new int[this->capacidade_corridas];
+    abrirGeracao();
+}
+
+// Destrutor
+GeracoesOnline::~GeracoesOnline() {
+    for (int g = 0; g < this->num_geracoes; g++) {
+        delete this->geracoes[g].arena;
+    }
+    delete[] this->geracoes;
+    delete[] this->livres;
+    delete[] this->geracao_por_corrida;
+}
+
+// Operações principais
+
+// Conta a corrida construída na geração atual, pelo índice na tabela
+void GeracoesOnline::registrarCorrida(int indice_corrida) {
+    if (indice_corrida >= this->capacidade_corridas) {
+        int nova_capacidade = 2 * this->capacidade_corridas > indice_corrida ? 2 * this->capacidade_corridas
+                                                                             : indice_corrida + 1;
+        int* novas = new int[nova_capacidade];
+        for (int k = 0; k < this->capacidade_corridas; k++) {
+            novas[k] = this->geracao_por_corrida[k];
+        }
+        delete[] this->geracao_por_corrida;
+        this->geracao_por_corrida = novas;
+        this->capacidade_corridas = nova_capacidade;
+    }
+    this->geracao_por_corrida[indice_corrida] = this->atual;
+    this->geracoes[this->atual].pendentes++;
+    this->corridas_atual++;
+    if (this->corridas_atual >= CORRIDAS_POR_GERACAO) {
+        abrirGeracao();
+    }
+}
+
+// Conta uma corrida escrita; libera a geração se for a última dela
+void GeracoesOnline::liberarCorrida(int indice_corrida) {
+    int geracao = this->geracao_por_corrida[indice_corrida];
+    this->geracoes[geracao].pendentes--;
+    if (this->geracoes[geracao].pendentes == 0 && geracao != this->atual) {
+        this->geracoes[geracao].arena->reiniciar();
+        this->livres[this->num_livres++] = geracao;
+    }
+}
+
+// Getters
+Arena* GeracoesOnline::getArenaAtual() const {
+    return this->geracoes[this->atual].arena;
+}
+
+int GeracoesOnline::getNumGeracoes() const {
+    return this->num_geracoes;
+}
+
+int GeracoesOnline::getPicoEmUso() const {
+    return this->pico_em_uso;
+}
+
+size_t GeracoesOnline::getBytesReservados() const {
+    size_t total = 0;
+    for (int g = 0; g < this->num_geracoes; g++) {
+        total += this->geracoes[g].arena->getBytesReservados();
+    }
+    return total;
+}
+
+// Métodos privados
+
+// Passa a construir numa geração livre (ou nova); a anterior é liberada
+// se todas as suas corridas já foram escritas
+void GeracoesOnline::abrirGeracao() {
+    int anterior = this->atual;
+    if (this->num_livres > 0) {
+        this->atual = this->livres[--this->num_livres];
+    } else {
+        if (this->num_geracoes == this->capacidade) {
+            int nova_capacidade = 2 * this->capacidade;
+            GeracaoCorridas* novas = new GeracaoCorridas[nova_capacidade];
+            int* novos_livres = new int[nova_capacidade];
+            for (int g = 0; g < this->num_geracoes; g++) {
+                novas[g] = this->geracoes[g];
+            }
+            delete[] this->geracoes;
+            delete[] this->livres;
+            this->geracoes = novas;
+            this->livres = novos_livres;
+            this->capacidade = nova_capacidade;
+        }
+        this->geracoes[this->num_geracoes].arena = new Arena();
+        this->geracoes[this->num_geracoes].pendentes = 0;
+        this->atual = this->num_geracoes++;
+    }
+    this->corridas_atual = 0;
+    
+    // A geração anterior pode já ter tido todas as corridas escritas
+    if (anterior >= 0 && this->geracoes[anterior].pendentes == 0) {
+        this->geracoes[anterior].arena->reiniciar();
+        this->livres[this->num_livres++] = anterior;
+    }
+    int em_uso = this->num_geracoes - this->num_livres;
+    if (em_uso > this->pico_em_uso) {
+        this->pico_em_uso = em_uso;
+    }
+}
@@ -0,0 +1,203 @@
+#include "GradeEspacial.hpp"
+#include <cmath>
+#include <cstdint>
+
+// Folga relativa no lado das células: um par a distância <= alfa (calculada
+// com arredondamento) nunca fica em células não vizinhas
+static const double FOLGA_CELULA = 1e-3;
+
+// Lado mínimo das células, para alfa/beta nulos
+static const double LADO_MINIMO = 1e-6;
+
+// Coordenadas de célula são saturadas neste valor; pontos além dele caem na
+// mesma célula de borda (a grade só fica menos seletiva, nunca incorreta)
+static const double CELULA_MAXIMA = 1e9;
+
+// Janelas com até este número de demandas são devolvidas inteiras: percorrer
+// as 9 células vizinhas custaria mais do que testar cada demanda
+static const int JANELA_MINIMA_GRADE = 16;
+
+static double calcularLado(double raio) {
+    double lado = raio * (1.0 + FOLGA_CELULA);
+    return lado > LADO_MINIMO ? lado : LADO_MINIMO;
+}
+
+static int calcularCelula(double coordenada, double lado) {
+    double celula = floor(coordenada / lado);
+    if (!(celula > -CELULA_MAXIMA)) {
+        return static_cast<int>(-CELULA_MAXIMA);
+    }
+    if (celula > CELULA_MAXIMA) {
+        return static_cast<int>(CELULA_MAXIMA);
+    }
+    return static_cast<int>(celula);
+}
+
+static bool vizinhas(int a, int b) {
+    return a - b <= 1 && b - a <= 1;
+}
+
+// Shell sort (sequência de Ciura); as listas costumam ser curtas
+static void ordenarIndices(int* indices, int tamanho) {
+    static const int LACUNAS[] = {701, 301, 132, 57, 23, 10, 4, 1};
+    for (int g = 0; g < 8; g++) {
+        int lacuna = LACUNAS[g];
+        for (int i = lacuna; i < tamanho; i++) {
+            int valor = indices[i];
+            int j = i;
+            while (j >= lacuna && indices[j - lacuna] > valor) {
+                indices[j] = indices[j - lacuna];
+                j -= lacuna;
+            }
+            indices[j] = valor;
+        }
+    }
+}
+
+// Construtor
+GradeEspacial::GradeEspacial(const DemandaStore* demandas, double delta, double alfa, double beta) {
+    this->habilitada = true;
+    this->celula_origem_x = nullptr;
+    this->celula_origem_y = nullptr;
+    this->celula_destino_x = nullptr;
+    this->celula_destino_y = nullptr;
+    this->limite_janela = nullptr;
+    this->faixas = nullptr;
+    this->cabecas = nullptr;
+    this->proximos = nullptr;
+    this->tamanho_tabela = 0;
+
+    int n = demandas->getTamanho();
+    const double* tempos = demandas->getTempos();
+
+    // A janela de i só é um intervalo contíguo de índices se os tempos
+    // estiverem em ordem não decrescente; caso contrário a grade não é usada
+    for (int i = 0; i < n; i++) {
+        if (tempos[i] != tempos[i] || (i > 0 && tempos[i] < tempos[i - 1])) {
+            this->habilitada = false;
+            return;
+        }
+    }
+
+    this->celula_origem_x = new int[n];
+    this->celula_origem_y = new int[n];
+    this->celula_destino_x = new int[n];
+    this->celula_destino_y = new int[n];
+    this->limite_janela = new int[n];
+    this->faixas = new int[n];
+    this->proximos = new int[n];
+
+    // Janela temporal de cada demanda (dois ponteiros: o limite só avança)
+    int limite = 0;
+    for (int i = 0; i < n; i++) {
+        if (limite < i + 1) {
+            limite = i + 1;
+        }
+        while (limite < n && !(tempos[limite] - tempos[i] >= delta)) {
+            limite++;
+        }
+        this->limite_janela[i] = limite;
+    }
+
+    // Faixas de tempo de largura delta; com delta nulo ou infinito, uma só
+    bool usa_faixas = delta > 0.0 && delta <= 1e300;
+    double lado_origem = calcularLado(alfa);
+    double lado_destino = calcularLado(beta);
+    const double* origens_x = demandas->getOrigensX();
+    const double* origens_y = demandas->getOrigensY();
+    const double* destinos_x = demandas->getDestinosX();
+    const double* destinos_y = demandas->getDestinosY();
+    for (int i = 0; i < n; i++) {
+        this->faixas[i] = usa_faixas && n > 0 ? calcularCelula(tempos[i] - tempos[0], delta) : 0;
+        this->celula_origem_x[i] = calcularCelula(origens_x[i], lado_origem);
+        this->celula_origem_y[i] = calcularCelula(origens_y[i], lado_origem);
+        this->celula_destino_x[i] = calcularCelula(destinos_x[i], lado_destino);
+        this->celula_destino_y[i] = calcularCelula(destinos_y[i], lado_destino);
+    }
+
+    // Tabela hash com encadeamento pelos próprios índices; inserir do fim
+    // para o início deixa cada cadeia em ordem crescente
+    this->tamanho_tabela = 16;
+    while (this->tamanho_tabela < 2 * n) {
+        this->tamanho_tabela *= 2;
+    }
+    this->cabecas = new int[this->tamanho_tabela];
+    for (int s = 0; s < this->tamanho_tabela; s++) {
+        this->cabecas[s] = -1;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        int slot = calcularSlot(this->faixas[i], this->celula_origem_x[i], this->celula_origem_y[i]);
+        this->proximos[i] = this->cabecas[slot];
+        this->cabecas[slot] = i;
+    }
+}
+
+// Destrutor
+GradeEspacial::~GradeEspacial() {
+    delete[] this->celula_origem_x;
+    delete[] this->celula_origem_y;
+    delete[] this->celula_destino_x;
+    delete[] this->celula_destino_y;
+    delete[] this->limite_janela;
+    delete[] this->faixas;
+    delete[] this->cabecas;
+    delete[] this->proximos;
+}
+
+// Consulta
+int GradeEspacial::buscarCandidatas(int indice, int* saida) const {
+    int inicio = indice + 1;
+    int fim = this->limite_janela[indice];
+    int total = 0;
+
+    if (fim - inicio <= JANELA_MINIMA_GRADE) {
+        for (int j = inicio; j < fim; j++) {
+            saida[total++] = j;
+        }
+        return total;
+    }
+
+    int ox = this->celula_origem_x[indice];
+    int oy = this->celula_origem_y[indice];
+    int dx = this->celula_destino_x[indice];
+    int dy = this->celula_destino_y[indice];
+    int faixa_final = this->faixas[fim - 1];
+
+    for (int faixa = this->faixas[inicio]; faixa <= faixa_final; faixa++) {
+        for (int cx = ox - 1; cx <= ox + 1; cx++) {
+            for (int cy = oy - 1; cy <= oy + 1; cy++) {
+                int j = this->cabecas[calcularSlot(faixa, cx, cy)];
+                while (j != -1 && j < fim) {
+                    if (j >= inicio && this->faixas[j] == faixa &&
+                        this->celula_origem_x[j] == cx && this->celula_origem_y[j] == cy &&
+                        vizinhas(this->celula_destino_x[j], dx) && vizinhas(this->celula_destino_y[j], dy)) {
+                        saida[total++] = j;
+                    }
+                    j = this->proximos[j];
+                }
+            }
+        }
+    }
+
+    // Mantém a ordem first-fit da varredura linear
+    ordenarIndices(saida, total);
+    return total;
+}
+
+// Getters
+bool GradeEspacial::estaHabilitada() const {
+    return this->habilitada;
+}
+
+int GradeEspacial::getLimiteJanela(int indice) const {
+    return this->limite_janela[indice];
+}
+
+// Métodos privados
+int GradeEspacial::calcularSlot(int faixa, int celula_x, int celula_y) const {
+    uint64_t chave = static_cast<uint64_t>(static_cast<uint32_t>(faixa)) * 0x9E3779B97F4A7C15ULL;
+    chave ^= static_cast<uint64_t>(static_cast<uint32_t>(celula_x)) * 0xC2B2AE3D27D4EB4FULL;
+    chave ^= static_cast<uint64_t>(static_cast<uint32_t>(celula_y)) * 0x165667B19E3779F9ULL;
+    chave ^= chave >> 29;
+    return static_cast<int>(chave & static_cast<uint64_t>(this->tamanho_tabela - 1));
+}
@@ -0,0 +1,211 @@
+#include "GrafoCompatibilidade.hpp"
+#include "GradeEspacial.hpp"
+#include <cmath>
+
+// Mesma fórmula do AvaliadorCorrida (início menos fim)
+static double distancia(double x1, double y1, double x2, double y2) {
+    double dx = x1 - x2;
+    double dy = y1 - y2;
+    return sqrt(dx * dx + dy * dy);
+}
+
+// Construtor
+GrafoCompatibilidade::GrafoCompatibilidade(const DemandaStore* demandas, double delta, double alfa, double beta) {
+    this->num_demandas = demandas->getTamanho();
+    this->delta = delta;
+    this->alfa = alfa;
+    this->beta = beta;
+    this->num_arestas = 0;
+    this->capacidade = this->num_demandas > 0 ? this->num_demandas : 1;
+    this->inicio_arestas = new long long[this->num_demandas + 1];
+    this->vizinhos = new int[this->capacidade];
+    this->distancias_origem = new double[this->capacidade];
+    this->distancias_destino = new double[this->capacidade];
+    this->rotas = new double[this->capacidade];
+    this->menores_origem = new double[this->num_demandas];
+    this->menores_destino = new double[this->num_demandas];
+    this->arestas_excedidas = false;
+
+    // A grade já exige tempos em ordem e devolve um superconjunto das
+    // arestas; as distâncias exatas decidem quais ficam
+    GradeEspacial grade(demandas, delta, alfa, beta);
+    this->habilitado = grade.estaHabilitada();
+    if (!this->habilitado) {
+        descartar();
+        return;
+    }
+
+    int maior_janela = 1;
+    for (int i = 0; i < this->num_demandas; i++) {
+        if (grade.getLimiteJanela(i) - i > maior_janela) {
+            maior_janela = grade.getLimiteJanela(i) - i;
+        }
+    }
+    int* candidatas = new int[maior_janela];
+
+    const double* origens_x = demandas->getOrigensX();
+    const double* origens_y = demandas->getOrigensY();
+    const double* destinos_x = demandas->getDestinosX();
+    const double* destinos_y = demandas->getDestinosY();
+    for (int i = 0; i < this->num_demandas && this->habilitado; i++) {
+        this->inicio_arestas[i] = this->num_arestas;
+        this->menores_origem[i] = INFINITY;
+        this->menores_destino[i] = INFINITY;
+        int num_candidatas = grade.buscarCandidatas(i, candidatas);
+        for (int c = 0; c < num_candidatas; c++) {
+            int j = candidatas[c];
+            double distancia_origem = distancia(origens_x[i], origens_y[i], origens_x[j], origens_y[j]);
+            double distancia_destino = distancia(destinos_x[i], destinos_y[i], destinos_x[j], destinos_y[j]);
+            if (distancia_origem > alfa || distancia_destino > beta) {
+                continue;
+            }
+            if (this->num_arestas == MAXIMO_ARESTAS) {
+                this->habilitado = false;
+                this->arestas_excedidas = true;
+                break;
+            }
+            // NaN passa no filtro acima e fica como menor (a lista nunca é pulada)
+            if (std::isnan(distancia_origem) || distancia_origem < this->menores_origem[i]) {
+                this->menores_origem[i] = distancia_origem;
+            }
+            if (std::isnan(distancia_destino) || distancia_destino < this->menores_destino[i]) {
+                this->menores_destino[i] = distancia_destino;
+            }
+
+            // Rota de dois membros, somada como em AvaliadorCorrida::somarRota
+            double rota = 0.0 + distancia_origem;
+            rota += distancia(origens_x[j], origens_y[j], destinos_x[i], destinos_y[i]);
+            rota += distancia_destino;
+            adicionarAresta(j, distancia_origem, distancia_destino, rota);
+        }
+    }
+    this->inicio_arestas[this->num_demandas] = this->num_arestas;
+    delete[] candidatas;
+
+    if (!this->habilitado) {
+        descartar();
+    }
+}
+
+// Destrutor
+GrafoCompatibilidade::~GrafoCompatibilidade() {
+    delete[] this->inicio_arestas;
+    delete[] this->vizinhos;
+    delete[] this->distancias_origem;
+    delete[] this->distancias_destino;
+    delete[] this->rotas;
+    delete[] this->menores_origem;
+    delete[] this->menores_destino;
+}
+
+// Consulta (busca binária: as arestas de cada demanda estão em ordem)
+long long GrafoCompatibilidade::buscarAresta(int demanda, int vizinho) const {
+    long long inicio = this->inicio_arestas[demanda];
+    long long fim = this->inicio_arestas[demanda + 1];
+    while (inicio < fim) {
+        long long meio = inicio + (fim - inicio) / 2;
+        if (this->vizinhos[meio] < vizinho) {
+            inicio = meio + 1;
+        } else {
+            fim = meio;
+        }
+    }
+    return inicio < this->inicio_arestas[demanda + 1] && this->vizinhos[inicio] == vizinho ? inicio : -1;
+}
+
+bool GrafoCompatibilidade::cobre(double delta, double alfa, double beta) const {
+    return this->habilitado && delta <= this->delta && alfa <= this->alfa && beta <= this->beta;
+}
+
+// Uma aresta só passa com as duas distâncias dentro dos limites; basta
+// uma das menores estar fora para que nenhuma passe
+bool GrafoCompatibilidade::temCandidatas(int demanda, double alfa, double beta) const {
+    return !(this->menores_origem[demanda] > alfa) && !(this->menores_destino[demanda] > beta);
+}
+
+// Getters
+bool GrafoCompatibilidade::estaHabilitado() const {
+    return this->habilitado;
+}
+
+bool GrafoCompatibilidade::excedeuArestas() const {
+    return this->arestas_excedidas;
+}
+
+long long GrafoCompatibilidade::getInicio(int demanda) const {
+    return this->inicio_arestas[demanda];
+}
+
+long long GrafoCompatibilidade::getFim(int demanda) const {
+    return this->inicio_arestas[demanda + 1];
+}
+
+long long GrafoCompatibilidade::getNumArestas() const {
+    return this->num_arestas;
+}
+
+const int* GrafoCompatibilidade::getVizinhos() const {
+    return this->vizinhos;
+}
+
+const double* GrafoCompatibilidade::getDistanciasOrigem() const {
+    return this->distancias_origem;
+}
+
+const double* GrafoCompatibilidade::getDistanciasDestino() const {
+    return this->distancias_destino;
+}
+
+const double* GrafoCompatibilidade::getRotas() const {
+    return this->rotas;
+}
+
+// Métodos privados
+void GrafoCompatibilidade::adicionarAresta(int vizinho, double distancia_origem, double distancia_destino,
+                                           double rota) {
+    if (this->num_arestas == this->capacidade) {
+        long long nova_capacidade = 2 * this->capacidade;
+        int* novos_vizinhos = new int[nova_capacidade];
+        double* novas_origens = new double[nova_capacidade];
+        double* novos_destinos = new double[nova_capacidade];
+        double* novas_rotas = new double[nova_capacidade];
+        for (long long a = 0; a < this->num_arestas; a++) {
+            novos_vizinhos[a] = this->vizinhos[a];
+            novas_origens[a] = this->distancias_origem[a];
+            novos_destinos[a] = this->distancias_destino[a];
+            novas_rotas[a] = this->rotas[a];
+        }
+        delete[] this->vizinhos;
+        delete[] this->distancias_origem;
+        delete[] this->distancias_destino;
+        delete[] this->rotas;
+        this->vizinhos = novos_vizinhos;
+        this->distancias_origem = novas_origens;
+        this->distancias_destino = novos_destinos;
+        this->rotas = novas_rotas;
+        this->capacidade = nova_capacidade;
+    }
+    this->vizinhos[this->num_arestas] = vizinho;
+    this->distancias_origem[this->num_arestas] = distancia_origem;
+    this->distancias_destino[this->num_arestas] = distancia_destino;
+    this->rotas[this->num_arestas] = rota;
+    this->num_arestas++;
+}
+
+// Libera as arestas de um grafo desabilitado (nenhuma consulta é válida)
+void GrafoCompatibilidade::descartar() {
+    delete[] this->vizinhos;
+    delete[] this->distancias_origem;
+    delete[] this->distancias_destino;
+    delete[] this->rotas;
+    this->vizinhos = nullptr;
+    this->distancias_origem = nullptr;
+    this->distancias_destino = nullptr;
+    this->rotas = nullptr;
+    delete[] this->menores_origem;
+    delete[] this->menores_destino;
+    this->menores_origem = nullptr;
+    this->menores_destino = nullptr;
+    this->num_arestas = 0;
+    this->capacidade = 0;
+}
@@ -0,0 +1,171 @@
+#include "HeapBinario.hpp"
+#include "Escalonador.hpp"
+
+// Construtor
+HeapBinario::HeapBinario(int capacidade_inicial) {
+    this->capacidade = capacidade_inicial > 0 ? capacidade_inicial : 1;
+    this->heap = new Evento*[this->capacidade];
+    this->tamanho = 0;
+}
+
+// Destrutor
+HeapBinario::~HeapBinario() {
+    delete[] this->heap;
+}
+
+// Operações principais
+void HeapBinario::inserir(Evento* evento) {
+    if (this->tamanho >= this->capacidade) {
+        redimensionar();
+    }
+
+    this->heap[this->tamanho] = evento;
+    evento->setPosicaoFila(this->tamanho);
+    heapifyUp(this->tamanho);
+    this->tamanho++;
+}
+
+// Acrescenta os eventos ao fim e refaz o heap de baixo para cima (Floyd):
+// O(n) em vez de O(n log n) das inserções individuais
+void HeapBinario::inserirLote(Evento* const* eventos, int quantidade) {
+    while (this->tamanho + quantidade > this->capacidade) {
+        redimensionar();
+    }
+    for (int i = 0; i < quantidade; i++) {
+        this->heap[this->tamanho + i] = eventos[i];
+        eventos[i]->setPosicaoFila(this->tamanho + i);
+    }
+    this->tamanho += quantidade;
+
+    for (int i = this->tamanho / 2 - 1; i >= 0; i--) {
+        heapifyDown(i);
+    }
+}
+
+Evento* HeapBinario::retirarMinimo() {
+    if (this->tamanho == 0) {
+        return nullptr;
+    }
+
+    Evento* evento_minimo = this->heap[0];
+    evento_minimo->setPosicaoFila(-1);
+    this->tamanho--;
+
+    if (this->tamanho > 0) {
+        this->heap[0] = this->heap[this->tamanho];
+        this->heap[0]->setPosicaoFila(0);
+        heapifyDown(0);
+    }
+
+    return evento_minimo;
+}
+
+void HeapBinario::atualizar(Evento* evento) {
+    reposicionar(evento->getPosicaoFila());
+}
+
+// O último evento ocupa o lugar do removido e sobe ou desce a partir dele
+void HeapBinario::remover(Evento* evento) {
+    int indice = evento->getPosicaoFila();
+    evento->setPosicaoFila(-1);
+    this->tamanho--;
+
+    if (indice < this->tamanho) {
+        this->heap[indice] = this->heap[this->tamanho];
+        this->heap[indice]->setPosicaoFila(indice);
+        reposicionar(indice);
+    }
+}
+
+void HeapBinario::limpar() {
+    this->tamanho = 0;
+}
+
+// Getters
+int HeapBinario::getTamanho() const {
+    return this->tamanho;
+}
+
+double HeapBinario::getTempoMinimo() const {
+    return this->heap[0]->getTempo();
+}
+
+Evento* HeapBinario::getEvento(int indice) const {
+    return this->heap[indice];
+}
+
+// Métodos privados do heap
+void HeapBinario::heapifyUp(int indice) {
+    while (indice > 0) {
+        int pai = getPai(indice);
+        if (*this->heap[indice] > *this->heap[pai]) {
+            break;
+        }
+        trocar(indice, pai);
+        indice = pai;
+    }
+}
+
+void HeapBinario::heapifyDown(int indice) {
+    while (true) {
+        int menor = indice;
+        int esquerdo = getFilhoEsquerdo(indice);
+        int direito = getFilhoDireito(indice);
+
+        if (esquerdo < this->tamanho && *this->heap[menor] > *this->heap[esquerdo]) {
+            menor = esquerdo;
+        }
+
+        if (direito < this->tamanho && *this->heap[menor] > *this->heap[direito]) {
+            menor = direito;
+        }
+
+        if (menor == indice) {
+            break;
+        }
+
+        trocar(indice, menor);
+        indice = menor;
+    }
+}
+
+void HeapBinario::reposicionar(int indice) {
+    if (indice > 0 && *this->heap[getPai(indice)] > *this->heap[indice]) {
+        heapifyUp(indice);
+    } else {
+        heapifyDown(indice);
+    }
+}
+
+void HeapBinario::redimensionar() {
+    int nova_capacidade = this->capacidade * 2;
+    Evento** novo_heap = new Evento*[nova_capacidade];
+
+    for (int i = 0; i < this->tamanho; i++) {
+        novo_heap[i] = this->heap[i];
+    }
+
+    delete[] this->heap;
+    this->heap = novo_heap;
+    this->capacidade = nova_capacidade;
+}
+
+int HeapBinario::getPai(int indice) const {
+    return (indice - 1) / 2;
+}
+
+int HeapBinario::getFilhoEsquerdo(int indice) const {
+    return 2 * indice + 1;
+}
+
+int HeapBinario::getFilhoDireito(int indice) const {
+    return 2 * indice + 2;
+}
+
+void HeapBinario::trocar(int indice1, int indice2) {
+    Evento* temp = this->heap[indice1];
+    this->heap[indice1] = this->heap[indice2];
+    this->heap[indice2] = temp;
+    this->heap[indice1]->setPosicaoFila(indice1);
+    this->heap[indice2]->setPosicaoFila(indice2);
+}
@@ -0,0 +1,187 @@
+#include "HeapDario.hpp"
+#include "Escalonador.hpp"
+#include <cstdint>
+#include <cstring>
+
+static_assert(ARIDADE_HEAP >= 2, "ARIDADE_HEAP deve ser pelo menos 2");
+
+// Os grupos de irmãos começam no índice 1; alinhá-lo a este valor faz cada
+// grupo (d * 16 bytes) começar numa linha de cache
+static const size_t ALINHAMENTO_GRUPO = 64;
+
+// Construtor
+HeapDario::HeapDario(int capacidade_inicial) {
+    this->bloco = nullptr;
+    this->entradas = nullptr;
+    this->tamanho = 0;
+    alocar(capacidade_inicial > 0 ? capacidade_inicial : 1);
+}
+
+// Destrutor
+HeapDario::~HeapDario() {
+    delete[] this->bloco;
+}
+
+// Operações principais
+
+// Sobe um "buraco" a partir do fim e grava a entrada uma única vez
+void HeapDario::inserir(Evento* evento) {
+    if (this->tamanho >= this->capacidade) {
+        redimensionar();
+    }
+
+    Entrada nova;
+    nova.tempo = evento->getTempo();
+    nova.evento = evento;
+
+    this->tamanho++;
+    subir(this->tamanho - 1, nova);
+}
+
+// Acrescenta os eventos ao fim e refaz o heap de baixo para cima (Floyd)
+void HeapDario::inserirLote(Evento* const* eventos, int quantidade) {
+    if (this->tamanho + quantidade > this->capacidade) {
+        int nova_capacidade = this->capacidade;
+        while (this->tamanho + quantidade > nova_capacidade) {
+            nova_capacidade *= 2;
+        }
+        redimensionar(nova_capacidade);
+    }
+    for (int i = 0; i < quantidade; i++) {
+        this->entradas[this->tamanho + i].tempo = eventos[i]->getTempo();
+        this->entradas[this->tamanho + i].evento = eventos[i];
+        eventos[i]->setPosicaoFila(this->tamanho + i);
+    }
+    this->tamanho += quantidade;
+
+    if (this->tamanho > 1) {
+        for (int i = (this->tamanho - 2) / ARIDADE; i >= 0; i--) {
+            descer(i, this->entradas[i]);
+        }
+    }
+}
+
+Evento* HeapDario::retirarMinimo() {
+    if (this->tamanho == 0) {
+        return nullptr;
+    }
+
+    Evento* evento_minimo = this->entradas[0].evento;
+    evento_minimo->setPosicaoFila(-1);
+    this->tamanho--;
+    if (this->tamanho > 0) {
+        descer(0, this->entradas[this->tamanho]);
+    }
+
+    return evento_minimo;
+}
+
+void HeapDario::atualizar(Evento* evento) {
+    int indice = evento->getPosicaoFila();
+    this->entradas[indice].tempo = evento->getTempo();
+    reposicionar(indice, this->entradas[indice]);
+}
+
+// A última entrada ocupa o lugar da removida e sobe ou desce a partir dele
+void HeapDario::remover(Evento* evento) {
+    int indice = evento->getPosicaoFila();
+    evento->setPosicaoFila(-1);
+    this->tamanho--;
+    if (indice < this->tamanho) {
+        reposicionar(indice, this->entradas[this->tamanho]);
+    }
+}
+
+void HeapDario::limpar() {
+    this->tamanho = 0;
+}
+
+// Getters
+int HeapDario::getTamanho() const {
+    return this->tamanho;
+}
+
+double HeapDario::getTempoMinimo() const {
+    return this->entradas[0].tempo;
+}
+
+Evento* HeapDario::getEvento(int indice) const {
+    return this->entradas[indice].evento;
+}
+
+// Métodos privados
+
+// Sobe o "buraco" em indice até o lugar da entrada e a grava uma única vez
+void HeapDario::subir(int indice, Entrada entrada) {
+    while (indice > 0) {
+        int pai = (indice - 1) / ARIDADE;
+        if (!(entrada.tempo < this->entradas[pai].tempo)) {
+            break;
+        }
+        this->entradas[indice] = this->entradas[pai];
+        this->entradas[indice].evento->setPosicaoFila(indice);
+        indice = pai;
+    }
+    this->entradas[indice] = entrada;
+    entrada.evento->setPosicaoFila(indice);
+}
+
+// Desce o "buraco" a partir de indice escolhendo o menor filho de cada grupo
+// e grava a entrada uma única vez, na posição final
+void HeapDario::descer(int indice, Entrada entrada) {
+    while (true) {
+        int primeiro = ARIDADE * indice + 1;
+        if (primeiro >= this->tamanho) {
+            break;
+        }
+        int fim = primeiro + ARIDADE < this->tamanho ? primeiro + ARIDADE : this->tamanho;
+
+        int menor = primeiro;
+        for (int filho = primeiro + 1; filho < fim; filho++) {
+            if (this->entradas[filho].tempo < this->entradas[menor].tempo) {
+                menor = filho;
+            }
+        }
+
+        if (!(this->entradas[menor].tempo < entrada.tempo)) {
+            break;
+        }
+        this->entradas[indice] = this->entradas[menor];
+        this->entradas[indice].evento->setPosicaoFila(indice);
+        indice = menor;
+    }
+    this->entradas[indice] = entrada;
+    entrada.evento->setPosicaoFila(indice);
+}
+
+void HeapDario::reposicionar(int indice, Entrada entrada) {
+    if (indice > 0 && entrada.tempo < this->entradas[(indice - 1) / ARIDADE].tempo) {
+        subir(indice, entrada);
+    } else {
+        descer(indice, entrada);
+    }
+}
+
+void HeapDario::alocar(int capacidade) {
+    size_t bytes = static_cast<size_t>(capacidade) * sizeof(Entrada) + ALINHAMENTO_GRUPO;
+    this->bloco = new char[bytes];
+
+    // Posiciona entradas[1] num endereço múltiplo de ALINHAMENTO_GRUPO
+    uintptr_t grupo = reinterpret_cast<uintptr_t>(this->bloco) + sizeof(Entrada);
+    grupo = (grupo + ALINHAMENTO_GRUPO - 1) & ~static_cast<uintptr_t>(ALINHAMENTO_GRUPO - 1);
+    this->entradas = reinterpret_cast<Entrada*>(grupo - sizeof(Entrada));
+    this->capacidade = capacidade;
+}
+
+void HeapDario::redimensionar() {
+    redimensionar(this->capacidade * 2);
+}
+
+void HeapDario::redimensionar(int nova_capacidade) {
+    char* bloco_antigo = this->bloco;
+    Entrada* entradas_antigas = this->entradas;
+
+    alocar(nova_capacidade);
+    memcpy(this->entradas, entradas_antigas, static_cast<size_t>(this->tamanho) * sizeof(Entrada));
+    delete[] bloco_antigo;
+}
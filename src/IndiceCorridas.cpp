@@ -0,0 +1,156 @@
+#include "IndiceCorridas.hpp"
+#include <cmath>
+#include <cstdint>
+
+enum SituacaoCorrida {
+    FORA,
+    NA_GRADE,
+    GLOBAL
+};
+
+// Coordenadas de célula são saturadas neste valor (ver GradeEspacial)
+static const double CELULA_MAXIMA = 1e9;
+
+// Construtor
+IndiceCorridas::IndiceCorridas(int capacidade, double lado_celula) {
+    this->lado_celula = lado_celula > 0.0 ? lado_celula : 1.0;
+    this->capacidade = capacidade > 0 ? capacidade : 1;
+
+    this->tamanho_tabela = 16;
+    while (this->tamanho_tabela < 2 * this->capacidade) {
+        this->tamanho_tabela *= 2;
+    }
+    this->cabecas = new int[this->tamanho_tabela];
+    for (int s = 0; s < this->tamanho_tabela; s++) {
+        this->cabecas[s] = -1;
+    }
+    this->cabeca_global = -1;
+
+    this->proximos = new int[this->capacidade];
+    this->anteriores = new int[this->capacidade];
+    this->celulas_x = new int[this->capacidade];
+    this->celulas_y = new int[this->capacidade];
+    this->situacoes = new unsigned char[this->capacidade];
+    for (int i = 0; i < this->capacidade; i++) {
+        this->situacoes[i] = FORA;
+    }
+}
+
+// Destrutor
+IndiceCorridas::~IndiceCorridas() {
+    delete[] this->cabecas;
+    delete[] this->proximos;
+    delete[] this->anteriores;
+    delete[] this->celulas_x;
+    delete[] this->celulas_y;
+    delete[] this->situacoes;
+}
+
+// Operações principais
+void IndiceCorridas::inserir(int corrida, double x, double y) {
+    remover(corrida);
+    this->celulas_x[corrida] = calcularCelula(x);
+    this->celulas_y[corrida] = calcularCelula(y);
+    this->situacoes[corrida] = NA_GRADE;
+    encadear(corrida, &this->cabecas[calcularSlot(this->celulas_x[corrida], this->celulas_y[corrida])]);
+}
+
+void IndiceCorridas::inserirGlobal(int corrida) {
+    remover(corrida);
+    this->situacoes[corrida] = GLOBAL;
+    encadear(corrida, &this->cabeca_global);
+}
+
+void IndiceCorridas::remover(int corrida) {
+    if (this->situacoes[corrida] == FORA) {
+        return;
+    }
+    int* cabeca = &this->cabeca_global;
+    if (this->situacoes[corrida] == NA_GRADE) {
+        cabeca = &this->cabecas[calcularSlot(this->celulas_x[corrida], this->celulas_y[corrida])];
+    }
+
+    int anterior = this->anteriores[corrida];
+    int proximo = this->proximos[corrida];
+    if (anterior == -1) {
+        *cabeca = proximo;
+    } else {
+        this->proximos[anterior] = proximo;
+    }
+    if (proximo != -1) {
+        this->anteriores[proximo] = anterior;
+    }
+    this->situacoes[corrida] = FORA;
+}
+
+int IndiceCorridas::buscar(double x, double y, double raio, int* saida) const {
+    int total = 0;
+    for (int c = this->cabeca_global; c != -1; c = this->proximos[c]) {
+        saida[total++] = c;
+    }
+
+    // floor e a saturação são monótonos: um ponto a menos de 'raio' de
+    // (x, y) em cada eixo cai numa célula deste intervalo
+    int x_min = calcularCelula(x - raio);
+    int x_max = calcularCelula(x + raio);
+    int y_min = calcularCelula(y - raio);
+    int y_max = calcularCelula(y + raio);
+
+    for (int cx = x_min; cx <= x_max; cx++) {
+        for (int cy = y_min; cy <= y_max; cy++) {
+            for (int c = this->cabecas[calcularSlot(cx, cy)]; c != -1; c = this->proximos[c]) {
+                if (this->celulas_x[c] == cx && this->celulas_y[c] == cy) {
+                    saida[total++] = c;
+                }
+            }
+        }
+    }
+    return total;
+}
+
+bool IndiceCorridas::estaNoAlcance(int corrida, double x, double y, double raio) const {
+    if (this->situacoes[corrida] != NA_GRADE) {
+        return this->situacoes[corrida] == GLOBAL;
+    }
+    int cx = this->celulas_x[corrida];
+    int cy = this->celulas_y[corrida];
+    return cx >= calcularCelula(x - raio) && cx <= calcularCelula(x + raio) &&
+           cy >= calcularCelula(y - raio) && cy <= calcularCelula(y + raio);
+}
+
+// Getters
+bool IndiceCorridas::estaNaGrade(int corrida) const {
+    return this->situacoes[corrida] == NA_GRADE;
+}
+
+bool IndiceCorridas::contem(int corrida) const {
+    return this->situacoes[corrida] != FORA;
+}
+
+// Métodos privados
+int IndiceCorridas::calcularCelula(double coordenada) const {
+    double celula = floor(coordenada / this->lado_celula);
+    if (!(celula > -CELULA_MAXIMA)) {
+        return static_cast<int>(-CELULA_MAXIMA);
+    }
+    if (celula > CELULA_MAXIMA) {
+        return static_cast<int>(CELULA_MAXIMA);
+    }
+    return static_cast<int>(celula);
+}
+
+int IndiceCorridas::calcularSlot(int celula_x, int celula_y) const {
+    uint64_t chave = static_cast<uint64_t>(static_cast<uint32_t>(celula_x)) * 0xC2B2AE3D27D4EB4FULL;
+    chave ^= static_cast<uint64_t>(static_cast<uint32_t>(celula_y)) * 0x165667B19E3779F9ULL;
+    chave ^= chave >> 29;
+    return static_cast<int>(chave & static_cast<uint64_t>(this->tamanho_tabela - 1));
+}
+
+void IndiceCorridas::encadear(int corrida, int* cabeca) {
+    this->anteriores[corrida] = -1;
+    this->proximos[corrida] = *cabeca;
+    if (*cabeca != -1) {
+        this->anteriores[*cabeca] = corrida;
+    }
+    *cabeca = corrida;
+}
@@ -0,0 +1,377 @@
+#include "InsercaoDinamica.hpp"
+#include "AvaliadorCorrida.hpp"
+#include "ConstrucaoCorridas.hpp"
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <iostream>
+#include <thread>
+
+// Inserir a demanda d numa corrida de rota O1..On D1..Dn produz
+// O1..On Od D1..Dn Dd, e o desvio é
+//   [d(On, Od) + d(Od, D1) - d(On, D1)] + d(Dn, Dd) >= d(Dn, Dd)
+// pela desigualdade triangular. Por isso a corrida é indexada pelo último
+// destino. Vale apenas se a rota da corrida for a das demandas cujos índices
+// no store são seus IDs (é assim que a fase 2 a reconstrói), com coordenadas
+// e comprimento finitos; as demais vão para a lista global e são sempre
+// avaliadas. Corridas fora de [2, eta) demandas não são candidatas.
+void registrarCorridaIndice(IndiceCorridas& indice, const DemandaStore& demandas, Corrida* corrida,
+                            int indice_corrida, int eta) {
+    int num = corrida->getNumDemandas();
+    if (num < 2 || num >= eta) {
+        indice.remover(indice_corrida);
+        return;
+    }
+    
+    int* ids = corrida->getIdsDemandas();
+    bool rota_consistente = true;
+    for (int k = 0; k < num && rota_consistente; k++) {
+        rota_consistente = ids[k] >= 0 && ids[k] < demandas.getTamanho() && demandas.getId(ids[k]) == ids[k];
+    }
+    
+    double comprimento = corrida->getDistanciaTotal();
+    double limite = (num + 2) * (comprimento + 1501.0);
+    if (rota_consistente && limite <= LIMITE_ARREDONDAMENTO_ROTA) {
+        double x = demandas.getDestinoX(ids[num - 1]);
+        double y = demandas.getDestinoY(ids[num - 1]);
+        if (std::isfinite(x) && std::isfinite(y)) {
+            indice.inserir(indice_corrida, x, y);
+            return;
+        }
+    }
+    indice.inserirGlobal(indice_corrida);
+}
+
+// Critérios de aceitação de uma corrida candidata. Empates de custo ficam
+// com a corrida de menor índice, como na varredura das corridas em ordem
+bool melhoraInsercao(const InsercaoEscolhida& atual, int corrida, double custo, double eficiencia,
+                     const ParametrosFase2& parametros) {
+    bool satisfaz_desvio = (custo <= parametros.desvio_maximo);
+    bool satisfaz_eficiencia = (eficiencia >= parametros.lambda);
+    bool melhor_custo = custo < atual.custo || (custo == atual.custo && corrida < atual.corrida);
+    return satisfaz_desvio && satisfaz_eficiencia && melhor_custo;
+}
+
+InsercaoEscolhida nenhumaInsercao(const ParametrosFase2& parametros) {
+    InsercaoEscolhida escolha;
+    escolha.corrida = -1;
+    escolha.custo = parametros.desvio_maximo + 1.0;
+    return escolha;
+}
+
+// Raio da consulta ao índice: cobre toda corrida cujo limite inferior do
+// desvio não exceda o custo inicial
+double raioBuscaInsercao(const ParametrosFase2& parametros) {
+    return parametros.desvio_maximo + 1.0 + 2.0 * MARGEM_LIMITE_DESVIO;
+}
+
+// Limite inferior do desvio de inserir a demanda numa corrida indexada na
+// grade: d(último destino, destino novo) menos a folga de arredondamento
+static double limiteInferiorDesvio(const DemandaStore& demandas, Corrida* corrida, double destino_x, double destino_y) {
+    int ultima = corrida->getIdsDemandas()[corrida->getNumDemandas() - 1];
+    double dx = demandas.getDestinoX(ultima) - destino_x;
+    double dy = demandas.getDestinoY(ultima) - destino_y;
+    return sqrt(dx * dx + dy * dy) - MARGEM_LIMITE_DESVIO;
+}
+
+// Caminho de referência: constrói (no rascunho) a corrida temporária com a
+// demanda adicional para cada corrida compartilhada
+static InsercaoEscolhida buscarInsercaoLinear(const DemandaStore& demandas, Corrida* const* corridas, int num_corridas,
+                                              int demanda, const ParametrosFase2& parametros, Arena& rascunho) {
+    InsercaoEscolhida melhor = nenhumaInsercao(parametros);
+    
+    // Testar inserção em todas as corridas COMPARTILHADAS
+    for (int j = 0; j < num_corridas; j++) {
+        Corrida* corrida_candidata = corridas[j];
+        
+        // Verificar se a corrida é compartilhada (>1 demanda); as
+        // individuais já inseridas foram liberadas
+        if (corrida_candidata == nullptr || corrida_candidata->getNumDemandas() < 2) {
+            continue; // Pular corridas individuais
+        }
+        
+        // Verificar capacidade
+        int passageiros_atuais = corrida_candidata->getNumDemandas();
+        if (passageiros_atuais >= parametros.eta) {
+            continue; // Corrida cheia
+        }
+        
+        // Montar array de demandas da corrida atual
+        // (o ID de cada demanda coincide com seu índice no store)
+        int* ids_corrida = corrida_candidata->getIdsDemandas();
+        int num_demandas_corrida = corrida_candidata->getNumDemandas();
+        int* demandas_corrida_temp = new (rascunho) int[num_demandas_corrida + 1];
+        for (int k = 0; k < num_demandas_corrida; k++) {
+            demandas_corrida_temp[k] = ids_corrida[k];
+        }
+        demandas_corrida_temp[num_demandas_corrida] = demanda;
+        
+        // Construir corrida temporária com demanda adicional
+        double distancia_original = corrida_candidata->getDistanciaTotal();
+        double tempo_inicio = corrida_candidata->getTempoInicio();
+        
+        Corrida* corrida_temp = construirCorrida(demandas, demandas_corrida_temp, num_demandas_corrida + 1,
+                                                 parametros.gama, tempo_inicio, rascunho);
+        double distancia_nova = corrida_temp->getDistanciaTotal();
+        double eficiencia_nova = calcularEficienciaCorrida(demandas, demandas_corrida_temp, num_demandas_corrida + 1, distancia_nova);
+        
+        // Calcular custo adicional (desvio)
+        double custo_adicional = distancia_nova - distancia_original;
+        
+        if (melhoraInsercao(melhor, j, custo_adicional, eficiencia_nova, parametros)) {
+            melhor.corrida = j;
+            melhor.custo = custo_adicional;
+        }
+    }
+    
+    return melhor;
+}
+
+// Mesma escolha da busca linear, visitando só as corridas devolvidas pelo
+// índice e avaliando-as sem construí-las. Apenas lê o índice e as
+// corridas, podendo rodar em paralelo (um avaliador e um buffer por thread)
+static InsercaoEscolhida buscarInsercaoIndice(const DemandaStore& demandas, Corrida* const* corridas,
+                                              const IndiceCorridas& indice, int demanda,
+                                              const ParametrosFase2& parametros, AvaliadorCorrida& avaliador,
+                                              int* candidatas) {
+    InsercaoEscolhida melhor = nenhumaInsercao(parametros);
+    
+    // Um desvio não finito nunca é aceito
+    double destino_x = demandas.getDestinoX(demanda);
+    double destino_y = demandas.getDestinoY(demanda);
+    if (!std::isfinite(destino_x) || !std::isfinite(destino_y)) {
+        return melhor;
+    }
+    
+    int num_candidatas = indice.buscar(destino_x, destino_y, raioBuscaInsercao(parametros), candidatas);
+    for (int c = 0; c < num_candidatas; c++) {
+        int j = candidatas[c];
+        Corrida* corrida_candidata = corridas[j];
+        int* ids_corrida = corrida_candidata->getIdsDemandas();
+        int num_demandas_corrida = corrida_candidata->getNumDemandas();
+        
+        // Corridas que não podem superar a melhor até aqui
+        if (indice.estaNaGrade(j) &&
+            limiteInferiorDesvio(demandas, corrida_candidata, destino_x, destino_y) > melhor.custo) {
+            continue;
+        }
+        
+        // Avaliação incremental, idêntica bit a bit à corrida construída
+        avaliador.iniciar(ids_corrida[0]);
+        for (int k = 1; k < num_demandas_corrida; k++) {
+            avaliador.adicionar(ids_corrida[k]);
+        }
+        double distancia_nova = avaliador.calcularDistanciaComAdicao(demanda);
+        double eficiencia_nova = avaliador.calcularEficienciaComAdicao(demanda);
+        double custo_adicional = distancia_nova - corrida_candidata->getDistanciaTotal();
+        
+        if (melhoraInsercao(melhor, j, custo_adicional, eficiencia_nova, parametros)) {
+            melhor.corrida = j;
+            melhor.custo = custo_adicional;
+        }
+    }
+    
+    return melhor;
+}
+
+// Constrói na arena a corrida antiga com a demanda adicional, com o mesmo
+// início
+static Corrida* construirInsercao(const DemandaStore& demandas, Corrida* corrida_antiga, int demanda,
+                                  const ParametrosFase2& parametros, Arena& arena, Arena& rascunho) {
+    int* ids_antiga = corrida_antiga->getIdsDemandas();
+    int num_nova = corrida_antiga->getNumDemandas() + 1;
+    int* demandas_nova = new (rascunho) int[num_nova];
+    for (int k = 0; k < num_nova - 1; k++) {
+        demandas_nova[k] = ids_antiga[k];
+    }
+    demandas_nova[num_nova - 1] = demanda;
+    Corrida* nova_corrida = construirCorrida(demandas, demandas_nova, num_nova, parametros.gama,
+                                             corrida_antiga->getTempoInicio(), arena);
+    
+    // Calcular eficiência da nova corrida
+    double eficiencia_nova = calcularEficienciaCorrida(demandas, demandas_nova, num_nova, nova_corrida->getDistanciaTotal());
+    nova_corrida->setEficiencia(eficiencia_nova);
+    return nova_corrida;
+}
+
+// Marca a demanda como combinada na corrida escolhida e coloca a nova
+// corrida no lugar da antiga. A tabela redireciona o evento pendente da
+// corrida antiga, se já houver um
+void confirmarInsercao(DemandaStore& demandas, TabelaCorridas& corridas, int demanda,
+                       const InsercaoEscolhida& escolha, Corrida* nova_corrida, const ParametrosFase2& parametros) {
+    // Atualizar estado da demanda inserida (as demandas da corrida
+    // original continuam apontando para o mesmo índice)
+    Demanda demanda_inserida = demandas.getDemanda(demanda);
+    demanda_inserida.setEstado(COMBINADA);
+    demanda_inserida.setIndiceCorrida(escolha.corrida);
+    
+    // Substituir corrida antiga pela nova (a antiga fica na arena)
+    corridas.substituir(escolha.corrida, nova_corrida);
+    
+    if (parametros.reportar_insercoes) {
+        std::cerr << "Demanda " << demandas.getId(demanda) << " inserida na corrida " << escolha.corrida 
+                  << " (desvio: " << escolha.custo << ")" << std::endl;
+    }
+}
+
+// Substitui a corrida escolhida por uma nova, com a demanda adicional, e
+// atualiza o índice (se houver). A corrida individual da demanda é
+// liberada, com a sua partida, se já estiver no escalonador. O modo
+// --online não passa por aqui: as corridas individuais que a fase 2
+// retiraria continuam na sua saída
+static void aplicarInsercao(DemandaStore& demandas, TabelaCorridas& corridas, int demanda,
+                            const InsercaoEscolhida& escolha, const ParametrosFase2& parametros, Arena& arena,
+                            Arena& rascunho, IndiceCorridas* indice) {
+    // Constrói a vencedora direto na arena da execução
+    Corrida* nova_corrida = construirInsercao(demandas, corridas.getCorrida(escolha.corrida), demanda, parametros,
+                                              arena, rascunho);
+    int individual = demandas.getIndiceCorrida(demanda);
+    confirmarInsercao(demandas, corridas, demanda, escolha, nova_corrida, parametros);
+    corridas.liberar(individual);
+    if (indice != nullptr) {
+        registrarCorridaIndice(*indice, demandas, nova_corrida, escolha.corrida, parametros.eta);
+    }
+}
+
+// Inserção dinâmica sequencial: cada demanda pendente, em ordem, entra na
+// melhor corrida compartilhada, pelo índice ou (sem ele) testando todas as
+// corridas. Retorna o número de inserções
+int inserirSequencial(DemandaStore& demandas, TabelaCorridas& corridas, int num_corridas, IndiceCorridas* indice,
+                      const int* pendentes, int num_pendentes, const ParametrosFase2& parametros,
+                      Arena& arena, Arena& rascunho) {
+    int* candidatas = new int[num_corridas > 0 ? num_corridas : 1];
+    AvaliadorCorrida avaliador(&demandas, parametros.eta);
+    int inseridas = 0;
+    
+    for (int k = 0; k < num_pendentes; k++) {
+        int demanda = pendentes[k];
+        rascunho.reiniciar();
+        
+        InsercaoEscolhida escolha;
+        if (indice != nullptr) {
+            escolha = buscarInsercaoIndice(demandas, corridas.getCorridas(), *indice, demanda, parametros,
+                                           avaliador, candidatas);
+        } else {
+            escolha = buscarInsercaoLinear(demandas, corridas.getCorridas(), num_corridas, demanda, parametros,
+                                           rascunho);
+        }
+        
+        // Se encontrou corrida adequada, substituir
+        if (escolha.corrida != -1) {
+            aplicarInsercao(demandas, corridas, demanda, escolha, parametros, arena, rascunho, indice);
+            inseridas++;
+        }
+    }
+    
+    delete[] candidatas;
+    return inseridas;
+}
+
+// Inserção dinâmica em lotes especulativos. As demandas de um lote são
+// avaliadas em paralelo contra o estado do início do lote e confirmadas em
+// ordem. As corridas não alteradas antes de uma demanda no mesmo lote têm o
+// mesmo custo para ela, e retirar uma corrida que não é a mínima não muda o
+// mínimo; logo a escolha especulativa só pode diferir da sequencial se a
+// corrida escolhida tiver sido alterada ou se uma corrida alterada puder
+// agora superá-la (limite inferior do desvio <= custo escolhido, ou corrida
+// sem limite). Nesses casos a demanda é reavaliada na thread principal.
+// Retorna o número de inserções
+int inserirEmParalelo(DemandaStore& demandas, TabelaCorridas& corridas, int num_corridas, IndiceCorridas& indice,
+                      const int* pendentes, int num_pendentes, const ParametrosFase2& parametros,
+                      int num_threads, Arena& arena, Arena& rascunho, int& reavaliacoes) {
+    int tamanho_lote = 64 * num_threads;
+    int capacidade_candidatas = num_corridas > 0 ? num_corridas : 1;
+    
+    AvaliadorCorrida** avaliadores = new AvaliadorCorrida*[num_threads];
+    int** candidatas = new int*[num_threads];
+    for (int t = 0; t < num_threads; t++) {
+        avaliadores[t] = new AvaliadorCorrida(&demandas, parametros.eta);
+        candidatas[t] = new int[capacidade_candidatas];
+    }
+    InsercaoEscolhida* escolhas = new InsercaoEscolhida[tamanho_lote];
+    int* modificadas = new int[tamanho_lote];
+    int* lote_modificacao = new int[capacidade_candidatas];
+    for (int j = 0; j < capacidade_candidatas; j++) {
+        lote_modificacao[j] = -1;
+    }
+    std::exception_ptr* erros = new std::exception_ptr[num_threads];
+    std::thread* threads = new std::thread[num_threads - 1];
+    double raio = raioBuscaInsercao(parametros);
+    int inseridas = 0;
+    
+    for (int inicio = 0, lote = 0; inicio < num_pendentes; inicio += tamanho_lote, lote++) {
+        int fim = inicio + tamanho_lote < num_pendentes ? inicio + tamanho_lote : num_pendentes;
+        
+        // Avaliação especulativa (somente leitura)
+        std::atomic<int> proxima(inicio);
+        auto avaliar = [&](int t) {
+            try {
+                for (int k = proxima++; k < fim; k = proxima++) {
+                    escolhas[k - inicio] = buscarInsercaoIndice(demandas, corridas.getCorridas(), indice, pendentes[k],
+                                                               parametros, *avaliadores[t], candidatas[t]);
+                }
+            } catch (...) {
+                erros[t] = std::current_exception();
+            }
+        };
+        for (int t = 1; t < num_threads; t++) {
+            threads[t - 1] = std::thread(avaliar, t);
+        }
+        avaliar(0);
+        for (int t = 1; t < num_threads; t++) {
+            threads[t - 1].join();
+        }
+        for (int t = 0; t < num_threads; t++) {
+            if (erros[t]) {
+                std::rethrow_exception(erros[t]);
+            }
+        }
+        
+        // Confirmação em ordem
+        int num_modificadas = 0;
+        for (int k = inicio; k < fim; k++) {
+            int demanda = pendentes[k];
+            InsercaoEscolhida escolha = escolhas[k - inicio];
+            
+            bool valida = escolha.corrida == -1 || lote_modificacao[escolha.corrida] != lote;
+            double destino_x = demandas.getDestinoX(demanda);
+            double destino_y = demandas.getDestinoY(demanda);
+            if (std::isfinite(destino_x) && std::isfinite(destino_y)) {
+                for (int m = 0; m < num_modificadas && valida; m++) {
+                    int corrida = modificadas[m];
+                    if (!indice.estaNoAlcance(corrida, destino_x, destino_y, raio)) {
+                        continue;
+                    }
+                    valida = indice.estaNaGrade(corrida) &&
+                             limiteInferiorDesvio(demandas, corridas.getCorrida(corrida), destino_x, destino_y) > escolha.custo;
+                }
+            }
+            if (!valida) {
+                escolha = buscarInsercaoIndice(demandas, corridas.getCorridas(), indice, demanda, parametros,
+                                               *avaliadores[0], candidatas[0]);
+                reavaliacoes++;
+            }
+            
+            if (escolha.corrida != -1) {
+                rascunho.reiniciar();
+                aplicarInsercao(demandas, corridas, demanda, escolha, parametros, arena, rascunho, &indice);
+                lote_modificacao[escolha.corrida] = lote;
+                modificadas[num_modificadas++] = escolha.corrida;
+                inseridas++;
+            }
+        }
+    }
+    
+    delete[] threads;
+    delete[] erros;
+    delete[] lote_modificacao;
+    delete[] modificadas;
+    delete[] escolhas;
+    for (int t = 0; t < num_threads; t++) {
+        delete avaliadores[t];
+        delete[] candidatas[t];
+    }
+    delete[] avaliadores;
+    delete[] candidatas;
+    return inseridas;
+}
@@ -0,0 +1,344 @@
+#include "LeitorEntrada.hpp"
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Tamanho dos blocos lidos quando a entrada não pode ser mapeada
+static const size_t TAMANHO_BLOCO = 1 << 20;
+
+// Potências de 10 exatamente representáveis em double
+static const double POTENCIAS_10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static bool ehEspaco(char c) {
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static bool ehDigito(char c) {
+    return c >= '0' && c <= '9';
+}
+
+// Construtor
+LeitorEntrada::LeitorEntrada(int descritor) {
+    this->descritor = descritor;
+    this->dados = nullptr;
+    this->posicao = 0;
+    this->fim = 0;
+    this->mapeamento = nullptr;
+    this->tamanho_mapeamento = 0;
+    this->buffer = nullptr;
+    this->capacidade_buffer = 0;
+    this->fim_arquivo = false;
+    this->linha = 1;
+
+    // Arquivos regulares são mapeados inteiros; o resto é lido em blocos
+    if (!mapearArquivo()) {
+        this->capacidade_buffer = TAMANHO_BLOCO;
+        this->buffer = new char[this->capacidade_buffer];
+        this->dados = this->buffer;
+    }
+}
+
+// Destrutor
+LeitorEntrada::~LeitorEntrada() {
+    if (this->mapeamento != nullptr) {
+        munmap(this->mapeamento, this->tamanho_mapeamento);
+    }
+    delete[] this->buffer;
+}
+
+// Leitura de valores
+bool LeitorEntrada::lerInteiro(int& valor) {
+    const char* p;
+    const char* termino;
+    if (!proximoToken(p, termino)) {
+        return false;
+    }
+
+    bool negativo = false;
+    if (*p == '+' || *p == '-') {
+        negativo = (*p == '-');
+        p++;
+    }
+    if (p == termino) {
+        return false;
+    }
+
+    long long acumulado = 0;
+    for (; p < termino; p++) {
+        if (!ehDigito(*p)) {
+            return false;
+        }
+        acumulado = acumulado * 10 + (*p - '0');
+        if (acumulado > (long long)INT_MAX + 1) {
+            return false;
+        }
+    }
+
+    if (negativo) {
+        acumulado = -acumulado;
+    }
+    if (acumulado > INT_MAX) {
+        return false;
+    }
+
+    valor = (int)acumulado;
+    return true;
+}
+
+bool LeitorEntrada::lerDecimal(double& valor) {
+    const char* inicio;
+    const char* termino;
+    if (!proximoToken(inicio, termino)) {
+        return false;
+    }
+
+    const char* p = inicio;
+    bool negativo = false;
+    if (*p == '+' || *p == '-') {
+        negativo = (*p == '-');
+        p++;
+    }
+
+    // Acumula até 19 dígitos significativos em um inteiro de 64 bits
+    unsigned long long mantissa = 0;
+    int digitos_significativos = 0;
+    int expoente = 0;
+    bool algum_digito = false;
+
+    for (; p < termino && ehDigito(*p); p++) {
+        algum_digito = true;
+        if (digitos_significativos < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            if (mantissa != 0) {
+                digitos_significativos++;
+            }
+        } else {
+            expoente++;
+            digitos_significativos++;
+        }
+    }
+
+    if (p < termino && *p == '.') {
+        p++;
+        for (; p < termino && ehDigito(*p); p++) {
+            algum_digito = true;
+            if (digitos_significativos < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                expoente--;
+                if (mantissa != 0) {
+                    digitos_significativos++;
+                }
+            } else {
+                digitos_significativos++;
+            }
+        }
+    }
+
+    if (!algum_digito) {
+        return false;
+    }
+
+    if (p < termino && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool expoente_negativo = false;
+        if (p < termino && (*p == '+' || *p == '-')) {
+            expoente_negativo = (*p == '-');
+            p++;
+        }
+        if (p == termino) {
+            return false;
+        }
+        int expoente_explicito = 0;
+        for (; p < termino && ehDigito(*p); p++) {
+            if (expoente_explicito < 100000) {
+                expoente_explicito = expoente_explicito * 10 + (*p - '0');
+            }
+        }
+        expoente += expoente_negativo ? -expoente_explicito : expoente_explicito;
+    }
+
+    if (p != termino) {
+        return false;
+    }
+
+    // Caminho rápido (Clinger): mantissa e potência exatas, uma única
+    // operação arredondada, resultado idêntico ao de strtod
+    if (digitos_significativos <= 19 && mantissa <= (1ULL << 53) &&
+        expoente >= -22 && expoente <= 22) {
+        double resultado = (double)mantissa;
+        if (expoente < 0) {
+            resultado /= POTENCIAS_10[-expoente];
+        } else {
+            resultado *= POTENCIAS_10[expoente];
+        }
+        valor = negativo ? -resultado : resultado;
+        return true;
+    }
+
+    // Caso geral: delega a conversão a strtod sobre uma cópia do token
+    // (na pilha, ou no heap para tokens longos)
+    char copia_curta[TAMANHO_TOKEN_CURTO + 1];
+    size_t tamanho = termino - inicio;
+    char* copia = tamanho <= TAMANHO_TOKEN_CURTO ? copia_curta : new char[tamanho + 1];
+    memcpy(copia, inicio, tamanho);
+    copia[tamanho] = '\0';
+
+    char* fim_conversao;
+    double resultado = strtod(copia, &fim_conversao);
+    bool convertido = fim_conversao == copia + tamanho && !std::isinf(resultado);
+    if (copia != copia_curta) {
+        delete[] copia;
+    }
+    if (!convertido) {
+        return false;
+    }
+
+    valor = resultado;
+    return true;
+}
+
+// Getters
+int LeitorEntrada::getLinha() const {
+    return this->linha;
+}
+
+bool LeitorEntrada::usaMapeamento() const {
+    return this->mapeamento != nullptr;
+}
+
+// Métodos auxiliares
+bool LeitorEntrada::mapearArquivo() {
+    struct stat informacoes;
+    if (fstat(this->descritor, &informacoes) != 0 || !S_ISREG(informacoes.st_mode) ||
+        informacoes.st_size <= 0) {
+        return false;
+    }
+
+    // Respeita o que já tiver sido consumido do descritor
+    off_t deslocamento = lseek(this->descritor, 0, SEEK_CUR);
+    if (deslocamento < 0 || deslocamento >= informacoes.st_size) {
+        return false;
+    }
+
+    size_t tamanho = (size_t)informacoes.st_size;
+    void* regiao = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, this->descritor, 0);
+    if (regiao == MAP_FAILED) {
+        return false;
+    }
+    madvise(regiao, tamanho, MADV_SEQUENTIAL);
+
+    this->mapeamento = static_cast<char*>(regiao);
+    this->tamanho_mapeamento = tamanho;
+    this->dados = this->mapeamento;
+    this->posicao = (size_t)deslocamento;
+    this->fim = tamanho;
+    this->fim_arquivo = true;
+    return true;
+}
+
+// Move o que falta consumir para o início do buffer e lê o próximo bloco
+bool LeitorEntrada::recarregar() {
+    if (this->fim_arquivo) {
+        return false;
+    }
+
+    size_t restante = this->fim - this->posicao;
+    memmove(this->buffer, this->buffer + this->posicao, restante);
+    this->posicao = 0;
+    this->fim = restante;
+
+    ssize_t lidos;
+    do {
+        lidos = read(this->descritor, this->buffer + this->fim, this->capacidade_buffer - this->fim);
+    } while (lidos < 0 && errno == EINTR);
+
+    if (lidos <= 0) {
+        this->fim_arquivo = true;
+        return false;
+    }
+
+    this->fim += (size_t)lidos;
+    return true;
+}
+
+// Dobra o buffer de blocos, preservando o que ainda não foi consumido
+void LeitorEntrada::ampliarBuffer() {
+    size_t nova_capacidade = 2 * this->capacidade_buffer;
+    char* novo_buffer = new char[nova_capacidade];
+    memcpy(novo_buffer, this->buffer + this->posicao, this->fim - this->posicao);
+    this->fim -= this->posicao;
+    this->posicao = 0;
+    delete[] this->buffer;
+    this->buffer = novo_buffer;
+    this->dados = this->buffer;
+    this->capacidade_buffer = nova_capacidade;
+}
+
+bool LeitorEntrada::garantirDados(size_t quantidade) {
+    while (this->fim - this->posicao < quantidade) {
+        if (!recarregar()) {
+            return this->fim > this->posicao;
+        }
+    }
+    return true;
+}
+
+// Delimita o próximo token, pulando espaços e contando linhas
+bool LeitorEntrada::proximoToken(const char*& inicio, const char*& termino) {
+    while (true) {
+        while (this->posicao < this->fim) {
+            char c = this->dados[this->posicao];
+            if (!ehEspaco(c)) {
+                break;
+            }
+            if (c == '\n') {
+                this->linha++;
+            }
+            this->posicao++;
+        }
+        if (this->posicao < this->fim) {
+            break;
+        }
+        if (!recarregar()) {
+            return false;
+        }
+    }
+
+    // Garante que o token inteiro esteja na janela (pode compactar o
+    // buffer); um token que chega ao fim da janela faz ler mais, ampliando
+    // o buffer quando ele estiver todo ocupado pelo token
+    garantirDados(TAMANHO_TOKEN_CURTO);
+
+    size_t tamanho = 0;
+    size_t p;
+    while (true) {
+        p = this->posicao + tamanho;
+        while (p < this->fim && !ehEspaco(this->dados[p])) {
+            p++;
+        }
+        tamanho = p - this->posicao;
+        if (p < this->fim || this->fim_arquivo) {
+            break;
+        }
+        if (this->posicao == 0 && this->fim == this->capacidade_buffer) {
+            ampliarBuffer();
+        }
+        if (!recarregar()) {
+            p = this->posicao + tamanho;
+            break;
+        }
+    }
+
+    inicio = this->dados + this->posicao;
+    termino = this->dados + p;
+    this->posicao = p;
+    return true;
+}
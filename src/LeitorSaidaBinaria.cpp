@@ -0,0 +1,228 @@
+#include "LeitorSaidaBinaria.hpp"
+#include <cstring>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace FormatoSaidaBinaria;
+
+// Tamanho de cada leitura quando o arquivo não pode ser mapeado
+static const size_t TAMANHO_BLOCO = 1 << 20;
+
+// Nome, tipo e largura esperados de cada coluna, na ordem de IndiceColuna
+struct ColunaEsperada {
+    const char* nome;
+    TipoColuna tipo;
+    uint32_t largura;
+};
+
+static const ColunaEsperada COLUNAS_ESPERADAS[NUM_COLUNAS] = {
+    {"tempo_conclusao", TIPO_F64, 8},
+    {"distancia_total", TIPO_F64, 8},
+    {"eficiencia", TIPO_F64, 8},
+    {"num_paradas", TIPO_I32, 4},
+    {"inicio_paradas", TIPO_I64, 8},
+    {"coordenadas", TIPO_F64, 8}
+};
+
+// Construtor
+LeitorSaidaBinaria::LeitorSaidaBinaria(int descritor) {
+    this->mapeamento = nullptr;
+    this->buffer = nullptr;
+    this->dados = nullptr;
+    this->tamanho = 0;
+    this->num_corridas = 0;
+    this->total_paradas = 0;
+    for (uint32_t c = 0; c < NUM_COLUNAS; c++) {
+        this->colunas[c] = nullptr;
+    }
+
+    if (!mapearArquivo(descritor) && !lerTudo(descritor)) {
+        this->erro = "falha ao ler o arquivo";
+        return;
+    }
+    this->erro = interpretar();
+}
+
+// Destrutor
+LeitorSaidaBinaria::~LeitorSaidaBinaria() {
+    if (this->mapeamento != nullptr) {
+        munmap(this->mapeamento, this->tamanho);
+    }
+    delete[] this->buffer;
+}
+
+// Validação
+bool LeitorSaidaBinaria::valido() const {
+    return this->erro == nullptr;
+}
+
+const char* LeitorSaidaBinaria::getErro() const {
+    return this->erro;
+}
+
+bool LeitorSaidaBinaria::verificarParadas() const {
+    const int32_t* num_paradas = getNumParadas();
+    const int64_t* inicio = getInicioParadas();
+    if (inicio[0] != 0) {
+        return false;
+    }
+    for (uint64_t i = 0; i < this->num_corridas; i++) {
+        if (num_paradas[i] < 0 || inicio[i + 1] - inicio[i] != num_paradas[i]) {
+            return false;
+        }
+    }
+    return static_cast<uint64_t>(inicio[this->num_corridas]) == this->total_paradas;
+}
+
+// Getters
+uint64_t LeitorSaidaBinaria::getNumCorridas() const {
+    return this->num_corridas;
+}
+
+uint64_t LeitorSaidaBinaria::getTotalParadas() const {
+    return this->total_paradas;
+}
+
+const double* LeitorSaidaBinaria::getTemposConclusao() const {
+    return static_cast<const double*>(this->colunas[COLUNA_TEMPO_CONCLUSAO]);
+}
+
+const double* LeitorSaidaBinaria::getDistanciasTotais() const {
+    return static_cast<const double*>(this->colunas[COLUNA_DISTANCIA_TOTAL]);
+}
+
+const double* LeitorSaidaBinaria::getEficiencias() const {
+    return static_cast<const double*>(this->colunas[COLUNA_EFICIENCIA]);
+}
+
+const int32_t* LeitorSaidaBinaria::getNumParadas() const {
+    return static_cast<const int32_t*>(this->colunas[COLUNA_NUM_PARADAS]);
+}
+
+const int64_t* LeitorSaidaBinaria::getInicioParadas() const {
+    return static_cast<const int64_t*>(this->colunas[COLUNA_INICIO_PARADAS]);
+}
+
+const double* LeitorSaidaBinaria::getCoordenadas() const {
+    return static_cast<const double*>(this->colunas[COLUNA_COORDENADAS]);
+}
+
+// Métodos auxiliares
+bool LeitorSaidaBinaria::mapearArquivo(int descritor) {
+    struct stat informacoes;
+    if (fstat(descritor, &informacoes) != 0 || !S_ISREG(informacoes.st_mode) || informacoes.st_size <= 0) {
+        return false;
+    }
+
+    size_t tamanho = (size_t)informacoes.st_size;
+    void* regiao = mmap(nullptr, tamanho, PROT_READ, MAP_PRIVATE, descritor, 0);
+    if (regiao == MAP_FAILED) {
+        return false;
+    }
+
+    this->mapeamento = static_cast<char*>(regiao);
+    this->dados = this->mapeamento;
+    this->tamanho = tamanho;
+    return true;
+}
+
+// Lê até o fim num buffer de uint64_t, que garante o alinhamento das colunas
+bool LeitorSaidaBinaria::lerTudo(int descritor) {
+    size_t capacidade = TAMANHO_BLOCO;
+    this->buffer = new uint64_t[capacidade / sizeof(uint64_t)];
+    size_t usado = 0;
+
+    while (true) {
+        if (usado == capacidade) {
+            uint64_t* novo_buffer = new uint64_t[2 * capacidade / sizeof(uint64_t)];
+            memcpy(novo_buffer, this->buffer, usado);
+            delete[] this->buffer;
+            this->buffer = novo_buffer;
+            capacidade *= 2;
+        }
+        ssize_t lidos = read(descritor, reinterpret_cast<char*>(this->buffer) + usado, capacidade - usado);
+        if (lidos < 0) {
+            return false;
+        }
+        if (lidos == 0) {
+            break;
+        }
+        usado += static_cast<size_t>(lidos);
+    }
+
+    this->dados = reinterpret_cast<const char*>(this->buffer);
+    this->tamanho = usado;
+    return true;
+}
+
+const char* LeitorSaidaBinaria::interpretar() {
+    if (this->tamanho < sizeof(Cabecalho)) {
+        return "arquivo menor que o cabecalho";
+    }
+
+    Cabecalho cabecalho;
+    memcpy(&cabecalho, this->dados, sizeof(cabecalho));
+    if (memcmp(cabecalho.magica, MAGICA, sizeof(MAGICA)) != 0) {
+        return "assinatura invalida (nao e uma saida binaria do tp2)";
+    }
+    if (cabecalho.marca_ordem != MARCA_ORDEM) {
+        return "ordem de bytes diferente da desta maquina";
+    }
+    if (cabecalho.versao != VERSAO) {
+        return "versao do formato nao suportada";
+    }
+    if (cabecalho.tamanho_cabecalho != sizeof(Cabecalho) + cabecalho.num_colunas * sizeof(DescritorColuna) ||
+        cabecalho.tamanho_cabecalho > this->tamanho) {
+        return "cabecalho truncado ou inconsistente";
+    }
+
+    this->num_corridas = cabecalho.num_corridas;
+    this->total_paradas = cabecalho.total_paradas;
+
+    // Colunas desconhecidas são ignoradas; as esperadas são obrigatórias
+    for (uint32_t c = 0; c < cabecalho.num_colunas; c++) {
+        DescritorColuna descritor;
+        memcpy(&descritor, this->dados + sizeof(Cabecalho) + c * sizeof(DescritorColuna), sizeof(descritor));
+        const char* erro_coluna = localizarColuna(descritor);
+        if (erro_coluna != nullptr) {
+            return erro_coluna;
+        }
+    }
+    for (uint32_t c = 0; c < NUM_COLUNAS; c++) {
+        if (this->colunas[c] == nullptr) {
+            return "coluna obrigatoria ausente";
+        }
+    }
+    return nullptr;
+}
+
+const char* LeitorSaidaBinaria::localizarColuna(const DescritorColuna& descritor) {
+    if (memchr(descritor.nome, '\0', TAMANHO_NOME) == nullptr) {
+        return "nome de coluna sem terminador";
+    }
+
+    for (uint32_t c = 0; c < NUM_COLUNAS; c++) {
+        const ColunaEsperada& esperada = COLUNAS_ESPERADAS[c];
+        if (strcmp(descritor.nome, esperada.nome) != 0) {
+            continue;
+        }
+        if (descritor.tipo != static_cast<uint32_t>(esperada.tipo) || descritor.largura != esperada.largura) {
+            return "tipo ou largura de coluna inesperados";
+        }
+
+        uint64_t esperados = c == COLUNA_INICIO_PARADAS ? this->num_corridas + 1
+                           : c == COLUNA_COORDENADAS ? 2 * this->total_paradas
+                           : this->num_corridas;
+        if (descritor.elementos != esperados) {
+            return "numero de elementos da coluna inconsistente";
+        }
+        if (descritor.deslocamento % ALINHAMENTO != 0 || descritor.deslocamento > this->tamanho ||
+            descritor.elementos > (this->tamanho - descritor.deslocamento) / descritor.largura) {
+            return "coluna fora do arquivo ou desalinhada";
+        }
+        this->colunas[c] = this->dados + descritor.deslocamento;
+        return nullptr;
+    }
+    return nullptr;
+}
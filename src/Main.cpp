@@ -1,92 +1,38 @@
 #include <iostream>
-#include <iomanip>
 #include <cmath>
+#include <chrono>
+#include <cstdlib>
+#include <atomic>
 #include <exception>
 #include <string>
+#include <thread>
+#include "LeitorEntrada.hpp"
+#include "Arena.hpp"
+#include "GradeEspacial.hpp"
+#include "GrafoCompatibilidade.hpp"
+#include "IndiceCorridas.hpp"
+#include "VerificadorCompatibilidade.hpp"
 #include "Demanda.hpp"
-#include "Parada.hpp"
-#include "Trecho.hpp"
 #include "Corrida.hpp"
 #include "Escalonador.hpp"
+#include "TabelaCorridas.hpp"
+#include "OrdenadorResultados.hpp"
+#include "SaidaContinua.hpp"
+#include "EscritorSaida.hpp"
+#include "SaidaBinaria.hpp"
+#include "SimulacaoException.hpp"
+#include "OpcoesExecucao.hpp"
+#include "EntradaDemandas.hpp"
+#include "ConstrucaoCorridas.hpp"
+#include "Agrupamento.hpp"
+#include "InsercaoDinamica.hpp"
+#include "DespachoSimulado.hpp"
+#include "ModoOnline.hpp"
+#include "Varredura.hpp"
+#include "Relatorios.hpp"
 
 using namespace std;
 
-// ==================== EXCEÇÕES CUSTOMIZADAS ====================
-
-class SimulacaoException : public exception {
-protected:
-    string mensagem;
-public:
-    SimulacaoException(const string& msg) : mensagem(msg) {}
-    virtual const char* what() const throw() {
-        return mensagem.c_str();
-    }
-};
-
-class ParametroInvalidoException : public SimulacaoException {
-public:
-    ParametroInvalidoException(const string& msg) : SimulacaoException(msg) {}
-};
-
-class DemandaInvalidaException : public SimulacaoException {
-public:
-    DemandaInvalidaException(const string& msg) : SimulacaoException(msg) {}
-};
-
-class MemoriaInsuficienteException : public SimulacaoException {
-public:
-    MemoriaInsuficienteException(const string& msg) : SimulacaoException(msg) {}
-};
-
-class EstadoInvalidoException : public SimulacaoException {
-public:
-    EstadoInvalidoException(const string& msg) : SimulacaoException(msg) {}
-};
-
-// ==================== ESTRUTURA PARA RESULTADOS ====================
-
-struct ResultadoCorrida {
-    double tempo_conclusao;
-    Corrida* corrida;
-};
-
-// ==================== FUNÇÕES DE ORDENAÇÃO (QUICKSORT) ====================
-
-void trocarResultados(ResultadoCorrida& a, ResultadoCorrida& b) {
-    ResultadoCorrida temp = a;
-    a = b;
-    b = temp;
-}
-
-int particionar(ResultadoCorrida* resultados, int inicio, int fim) {
-    double pivo = resultados[fim].tempo_conclusao;
-    int i = inicio - 1;
-    
-    for (int j = inicio; j < fim; j++) {
-        if (resultados[j].tempo_conclusao <= pivo) {
-            i++;
-            trocarResultados(resultados[i], resultados[j]);
-        }
-    }
-    
-    trocarResultados(resultados[i + 1], resultados[fim]);
-    return i + 1;
-}
-
-void quicksort(ResultadoCorrida* resultados, int inicio, int fim) {
-    if (inicio < fim) {
-        int pivo = particionar(resultados, inicio, fim);
-        quicksort(resultados, inicio, pivo - 1);
-        quicksort(resultados, pivo + 1, fim);
-    }
-}
-
-void ordenarResultados(ResultadoCorrida* resultados, int tamanho) {
-    if (tamanho > 1) {
-        quicksort(resultados, 0, tamanho - 1);
-    }
-}
-
 // ==================== FUNÇÕES AUXILIARES ====================
 
 double calcularDistancia(double x1, double y1, double x2, double y2) {
@@ -95,146 +41,33 @@ double calcularDistancia(double x1, double y1, double x2, double y2) {
     return sqrt(dx * dx + dy * dy);
 }
 
-void validarParametros(int eta, double gama, double delta, double alfa, double beta, double lambda) {
-    if (eta <= 0) {
-        throw ParametroInvalidoException("Capacidade do veiculo (eta) deve ser positiva");
-    }
-    if (gama <= 0.0) {
-        throw ParametroInvalidoException("Velocidade do veiculo (gama) deve ser positiva");
-    }
-    if (delta < 0.0) {
-        throw ParametroInvalidoException("Intervalo temporal (delta) nao pode ser negativo");
-    }
-    if (alfa < 0.0) {
-        throw ParametroInvalidoException("Distancia maxima entre origens (alfa) nao pode ser negativa");
-    }
-    if (beta < 0.0) {
-        throw ParametroInvalidoException("Distancia maxima entre destinos (beta) nao pode ser negativa");
-    }
-    if (lambda < 0.0 || lambda > 1.0) {
-        throw ParametroInvalidoException("Eficiencia minima (lambda) deve estar entre 0 e 1");
-    }
-}
-
-bool verificarCriteriosCompartilhamento(Demanda** demandas_corrida, int num_demandas, 
-                                        Demanda* nova_demanda, double alfa, double beta) {
-    // Verificar distâncias entre todas as origens
-    for (int i = 0; i < num_demandas; i++) {
-        double dist_origem = demandas_corrida[i]->calcularDistanciaOrigem(*nova_demanda);
-        if (dist_origem > alfa) {
-            return false;
-        }
-    }
-    
-    // Verificar distâncias entre todos os destinos
-    for (int i = 0; i < num_demandas; i++) {
-        double dist_destino = demandas_corrida[i]->calcularDistanciaDestino(*nova_demanda);
-        if (dist_destino > beta) {
-            return false;
-        }
-    }
-    
-    return true;
-}
-
-Corrida* construirCorrida(Demanda** demandas_corrida, int num_demandas, double gama, double tempo_inicio) {
-    if (num_demandas <= 0) {
-        throw EstadoInvalidoException("Tentativa de construir corrida sem demandas");
-    }
-    
-    Corrida* corrida = new Corrida(num_demandas);
-    
-    // Adicionar IDs das demandas
-    for (int i = 0; i < num_demandas; i++) {
-        corrida->adicionarDemanda(demandas_corrida[i]->getId());
-    }
-    
-    // Criar paradas de embarque (origens) na ordem das demandas
-    for (int i = 0; i < num_demandas; i++) {
-        Parada* parada_embarque = new Parada(
-            demandas_corrida[i]->getOrigemX(),
-            demandas_corrida[i]->getOrigemY(),
-            EMBARQUE,
-            demandas_corrida[i]->getId()
-        );
-        corrida->adicionarParada(parada_embarque);
-    }
-    
-    // Criar paradas de desembarque (destinos) na ordem das demandas
-    for (int i = 0; i < num_demandas; i++) {
-        Parada* parada_desembarque = new Parada(
-            demandas_corrida[i]->getDestinoX(),
-            demandas_corrida[i]->getDestinoY(),
-            DESEMBARQUE,
-            demandas_corrida[i]->getId()
-        );
-        corrida->adicionarParada(parada_desembarque);
-    }
-    
-    // Criar trechos
-    Parada** paradas = corrida->getParadas();
-    int total_paradas = corrida->getNumParadas();
-    
-    for (int i = 0; i < total_paradas - 1; i++) {
-        // Determinar natureza do trecho
-        NaturezaTrecho natureza;
-        if (paradas[i]->getTipo() == EMBARQUE && paradas[i+1]->getTipo() == EMBARQUE) {
-            natureza = COLETA;
-        } else if (paradas[i]->getTipo() == DESEMBARQUE && paradas[i+1]->getTipo() == DESEMBARQUE) {
-            natureza = ENTREGA;
-        } else {
-            natureza = DESLOCAMENTO;
-        }
-        
-        Trecho* trecho = new Trecho(paradas[i], paradas[i+1], 0.0, 0.0, natureza);
-        trecho->calcularTempoDistancia(gama);
-        corrida->adicionarTrecho(trecho);
-    }
-    
-    // Calcular duração e distância total
-    corrida->calcularDuracaoDistancia();
-    
-    return corrida;
-}
-
-double calcularEficienciaCorrida(Demanda** demandas_corrida, int num_demandas, double distancia_total) {
-    if (distancia_total == 0.0) {
-        return 1.0;
-    }
-    
-    double soma_distancias_individuais = 0.0;
-    for (int i = 0; i < num_demandas; i++) {
-        soma_distancias_individuais += demandas_corrida[i]->calcularDistanciaCorrida();
-    }
-    
-    return soma_distancias_individuais / distancia_total;
-}
-
-void imprimirCorrida(Corrida* corrida, double tempo_conclusao) {
-    // Formato: <tempo_conclusão> <distância_total> <eficiência> <num_paradas> <x1> <y1> <x2> <y2> ...
-    cout << fixed << setprecision(2);
-    cout << tempo_conclusao << " ";
-    cout << corrida->getDistanciaTotal() << " ";
-    cout << corrida->getEficiencia() << " ";  // ← ADICIONADO
-    cout << corrida->getNumParadas();
-    
-    Parada** paradas = corrida->getParadas();
-    for (int i = 0; i < corrida->getNumParadas(); i++) {
-        cout << " " << paradas[i]->getCoordX() << " " << paradas[i]->getCoordY();
-    }
-    cout << endl;
-}
+// Capacidade inicial do escalonador da execução em lote: as partidas entram
+// aos poucos, e as filas crescem com as corridas em andamento
+const int CAPACIDADE_INICIAL_ESCALONADOR = 4096;
 
 // ==================== MAIN ====================
 
-int main() {
+int main(int argc, char** argv) {
     try {
+        OpcoesExecucao opcoes = lerOpcoes(argc, argv);
+        if (opcoes.varredura != nullptr) {
+            executarVarredura(opcoes.varredura, opcoes);
+            return 0;
+        }
+        
+        chrono::steady_clock::time_point inicio_leitura = chrono::steady_clock::now();
+        
+        LeitorEntrada* leitor = nullptr;
+        if (!opcoes.leitura_stream) {
+            leitor = new LeitorEntrada(0);
+        }
+        
         // Leitura dos parâmetros
         int eta;
         double gama, delta, alfa, beta, lambda;
         int num_demandas;
         
-        cin >> eta >> gama >> delta >> alfa >> beta >> lambda >> num_demandas;
+        lerCabecalho(leitor, eta, gama, delta, alfa, beta, lambda, num_demandas);
         
         // Validar parâmetros
         validarParametros(eta, gama, delta, alfa, beta, lambda);
@@ -243,109 +76,214 @@ int main() {
             throw ParametroInvalidoException("Numero de demandas deve ser positivo");
         }
         
-        // Alocar array de demandas
-        Demanda** demandas = new Demanda*[num_demandas];
-        if (demandas == nullptr) {
-            throw MemoriaInsuficienteException("Falha ao alocar memoria para demandas");
+        if (opcoes.online) {
+            ParametrosFase1 parametros_online;
+            parametros_online.eta = eta;
+            parametros_online.gama = gama;
+            parametros_online.delta = delta;
+            parametros_online.alfa = alfa;
+            parametros_online.beta = beta;
+            parametros_online.lambda = lambda;
+            parametros_online.avaliacao_reconstrucao = opcoes.avaliacao_reconstrucao;
+            parametros_online.grade = nullptr;
+            parametros_online.grafo = nullptr;
+            
+            executarOnline(leitor, num_demandas, parametros_online, opcoes);
+            delete leitor;
+            return 0;
         }
         
+        // Armazenamento colunar das demandas
+        DemandaStore demandas(num_demandas);
+        
         // Ler demandas
-        for (int i = 0; i < num_demandas; i++) {
-            int id;
-            double tempo, ox, oy, dx, dy;
-            cin >> id >> tempo >> ox >> oy >> dx >> dy;
-            
-            demandas[i] = new Demanda(id, tempo, ox, oy, dx, dy);
-            if (demandas[i] == nullptr) {
-                throw MemoriaInsuficienteException("Falha ao alocar memoria para demanda");
-            }
+        lerDemandas(leitor, num_demandas, demandas);
+        
+        delete leitor;
+        
+        if (opcoes.exibir_tempos) {
+            cerr << "Tempo de leitura: " << segundosDesde(inicio_leitura) << " s" << endl;
+        }
+        
+        if (opcoes.somente_leitura) {
+            return 0;
         }
         
-        // Array de corridas criadas
-        Corrida** corridas = new Corrida*[num_demandas];
         int num_corridas = 0;
         
+        // Corridas, paradas, trechos e eventos da execução vivem na arena
+        // principal; corridas candidatas e arrays temporários vão para a
+        // arena de rascunho, reiniciada a cada demanda avaliada
+        Arena arena_execucao;
+        Arena arena_rascunho;
+        
         // Escalonador de eventos
-        Escalonador escalonador(num_demandas * 10);
+        // Os eventos vêm do pool do próprio escalonador e são reciclados
+        Escalonador escalonador(CAPACIDADE_INICIAL_ESCALONADOR, nullptr, opcoes.fila);
         escalonador.inicializa();
         
+        // Corridas criadas, por índice e geração; a inserção dinâmica
+        // substitui corridas que já podem ter a partida escalonada
+        TabelaCorridas corridas(num_demandas, &escalonador);
+        
         // ==================== CONSTRUÇÃO DAS CORRIDAS ====================
         
-        for (int i = 0; i < num_demandas; i++) {
-            // Pular demandas já processadas
-            if (demandas[i]->getEstado() != DEMANDADA) {
-                continue;
+        chrono::steady_clock::time_point inicio_fase1 = chrono::steady_clock::now();
+        
+        const double* tempos = demandas.getTempos();
+        const unsigned char* estados = demandas.getEstados();
+        
+        // Grade espacial: descarta, sem calcular distâncias, as demandas da
+        // janela cujas origens/destinos estão longe demais da demanda base
+        GradeEspacial grade(&demandas, delta, alfa, beta);
+        
+        ParametrosFase1 parametros;
+        parametros.eta = eta;
+        parametros.gama = gama;
+        parametros.delta = delta;
+        parametros.alfa = alfa;
+        parametros.beta = beta;
+        parametros.lambda = lambda;
+        parametros.avaliacao_reconstrucao = opcoes.avaliacao_reconstrucao;
+        parametros.grade = (!opcoes.indice_linear && grade.estaHabilitada()) ? &grade : nullptr;
+        
+        // Grafo de compatibilidade: numa execução única só compensa ao
+        // comparar com o cálculo direto, por isso precisa ser pedido
+        GrafoCompatibilidade* grafo = nullptr;
+        parametros.grafo = nullptr;
+        if (opcoes.compatibilidade == COMPATIBILIDADE_GRAFO) {
+            chrono::steady_clock::time_point inicio_grafo = chrono::steady_clock::now();
+            grafo = new GrafoCompatibilidade(&demandas, delta, alfa, beta);
+            if (grafo->cobre(delta, alfa, beta)) {
+                parametros.grafo = grafo;
             }
-            
-            // Conjunto de demandas para a corrida atual
-            Demanda** demandas_corrida = new Demanda*[eta];
-            demandas_corrida[0] = demandas[i];
-            int num_demandas_corrida = 1;
-            
-            double tempo_base = demandas[i]->getTempoSolicitacao();
-            
-            // Tentar combinar com outras demandas
-            for (int j = i + 1; j < num_demandas && num_demandas_corrida < eta; j++) {
-                if (demandas[j]->getEstado() != DEMANDADA) {
-                    continue;
-                }
-                
-                // Critério 1: Intervalo de tempo
-                double diff_tempo = demandas[j]->getTempoSolicitacao() - tempo_base;
-                if (diff_tempo >= delta) {
-                    break; // Não há mais candidatos dentro do intervalo
-                }
-                
-                // Critério 2 e 3: Distância entre origens e destinos
-                if (!verificarCriteriosCompartilhamento(demandas_corrida, num_demandas_corrida, demandas[j], alfa, beta)) {
-                    continue;
-                }
-                
-                // Construir corrida temporária para verificar eficiência
-                demandas_corrida[num_demandas_corrida] = demandas[j];
-                num_demandas_corrida++;
-                
-                Corrida* corrida_temp = construirCorrida(demandas_corrida, num_demandas_corrida, gama, tempo_base);
-                double eficiencia = calcularEficienciaCorrida(demandas_corrida, num_demandas_corrida, corrida_temp->getDistanciaTotal());
-                
-                // Critério 4: Eficiência
-                if (eficiencia < lambda) {
-                    // Remover última demanda adicionada
-                    num_demandas_corrida--;
-                    delete corrida_temp;
-                    break;
-                }
-                
-                delete corrida_temp;
+            if (!grafo->estaHabilitado()) {
+                avisarGrafoDesabilitado(*grafo);
+            } else if (opcoes.exibir_tempos) {
+                imprimirEstatisticasGrafo(*grafo, segundosDesde(inicio_grafo));
             }
-            
-            // Construir corrida final
-            Corrida* corrida_final = construirCorrida(demandas_corrida, num_demandas_corrida, gama, tempo_base);
-            double eficiencia_final = calcularEficienciaCorrida(demandas_corrida, num_demandas_corrida, corrida_final->getDistanciaTotal());
-            corrida_final->setEficiencia(eficiencia_final);
-            
-            // Atualizar estado das demandas
-            for (int k = 0; k < num_demandas_corrida; k++) {
-                if (num_demandas_corrida == 1) {
-                    demandas_corrida[k]->setEstado(INDIVIDUAL);
-                } else {
-                    demandas_corrida[k]->setEstado(COMBINADA);
+        }
+        
+        // Lotes independentes distribuídos entre as threads (vários por
+        // thread, para equilibrar a carga); sequencialmente, um lote só
+        int* limites_lotes = new int[num_demandas + 1];
+        int num_lotes = 1;
+        limites_lotes[0] = 0;
+        limites_lotes[1] = num_demandas;
+        if (opcoes.threads > 1) {
+            int tamanho_minimo = num_demandas / (opcoes.threads * 8);
+            if (tamanho_minimo < 1024) {
+                tamanho_minimo = 1024;
+            }
+            num_lotes = dividirEmLotes(tempos, num_demandas, delta, tamanho_minimo, limites_lotes);
+        }
+        int num_trabalhadores = opcoes.threads < num_lotes ? opcoes.threads : num_lotes;
+        
+        // O primeiro trabalhador usa as arenas da execução; os demais têm as
+        // suas, mantidas até o fim porque guardam corridas
+        Arena* arenas_trabalhadores = new Arena[2 * (num_trabalhadores - 1)];
+        TrabalhadorFase1** trabalhadores = new TrabalhadorFase1*[num_trabalhadores];
+        trabalhadores[0] = new TrabalhadorFase1(&demandas, parametros, opcoes.isa, &arena_execucao, &arena_rascunho);
+        for (int t = 1; t < num_trabalhadores; t++) {
+            trabalhadores[t] = new TrabalhadorFase1(&demandas, parametros, opcoes.isa,
+                                                    &arenas_trabalhadores[2 * (t - 1)],
+                                                    &arenas_trabalhadores[2 * (t - 1) + 1]);
+        }
+        
+        if (opcoes.exibir_tempos) {
+            cerr << "Conjunto de instrucoes: "
+                 << VerificadorCompatibilidade::nomeConjuntoInstrucoes(trabalhadores[0]->verificador.getConjuntoInstrucoes())
+                 << endl;
+            cerr << "Fase 1: " << num_trabalhadores << " thread(s), " << num_lotes << " lote(s)" << endl;
+        }
+        
+        Corrida** corridas_por_base = new Corrida*[num_demandas];
+        for (int i = 0; i < num_demandas; i++) {
+            corridas_por_base[i] = nullptr;
+        }
+        
+        atomic<int> proximo_lote(0);
+        exception_ptr* erros = new exception_ptr[num_trabalhadores];
+        auto executarTrabalhador = [&](int t) {
+            try {
+                for (int lote = proximo_lote++; lote < num_lotes; lote = proximo_lote++) {
+                    agruparLote(demandas, parametros, *trabalhadores[t], limites_lotes[lote],
+                                limites_lotes[lote + 1], corridas_por_base);
                 }
-                demandas_corrida[k]->setCorridaAssociada(corrida_final);
+            } catch (...) {
+                erros[t] = current_exception();
             }
-            
-            corridas[num_corridas] = corrida_final;
+        };
+        
+        thread* threads = new thread[num_trabalhadores - 1];
+        for (int t = 1; t < num_trabalhadores; t++) {
+            threads[t - 1] = thread(executarTrabalhador, t);
+        }
+        executarTrabalhador(0);
+        for (int t = 1; t < num_trabalhadores; t++) {
+            threads[t - 1].join();
+        }
+        delete[] threads;
+        
+        for (int t = 0; t < num_trabalhadores; t++) {
+            if (erros[t]) {
+                rethrow_exception(erros[t]);
+            }
+        }
+        delete[] erros;
+        
+        // Junção na ordem original: numera as corridas pela demanda base. No
+        // avanço direto a partida (primeira coleta) fica no array de
+        // resultados, trocada depois pela conclusão; na simulação por eventos
+        // ela só entra no escalonador quando a simulação a alcança (ver
+        // alimentarPartidas). A saída contínua não tem array de resultados.
+        // Na inserção durante a simulação, as demandas individuais entram
+        // como chegadas, e a corrida individual só parte se a demanda não
+        // couber numa corrida em andamento
+        ResultadoCorrida* resultados = nullptr;
+        DespachoSimulado* despacho = nullptr;
+        if (opcoes.insercao_simulada) {
+            despacho = new DespachoSimulado(num_demandas);
+        }
+        if (!opcoes.saida_continua) {
+            resultados = new ResultadoCorrida[num_demandas];
+        }
+        int* indice_por_base = new int[num_demandas];
+        for (int i = 0; i < num_demandas; i++) {
+            if (corridas_por_base[i] == nullptr) {
+                continue;
+            }
+            ReferenciaCorrida referencia = corridas.registrar(corridas_por_base[i]);
+            indice_por_base[i] = referencia.indice;
             num_corridas++;
             
-            // Escalonar primeiro evento (primeira coleta)
-            Evento* primeiro_evento = new Evento(tempo_base, COLETA_PASSAGEIRO, corrida_final, 0);
-            escalonador.insereEvento(primeiro_evento);
-            
-            delete[] demandas_corrida;
+            if (despacho != nullptr) {
+                despacho->demanda_por_corrida[referencia.indice] = estados[i] == INDIVIDUAL ? i : -1;
+            }
+            if (!opcoes.simulacao_eventos) {
+                resultados[referencia.indice].tempo_conclusao = tempos[i];
+            }
+        }
+        for (int i = 0; i < num_demandas; i++) {
+            demandas.setIndiceCorrida(i, indice_por_base[demandas.getIndiceCorrida(i)]);
         }
+        
+        delete[] indice_por_base;
+        delete[] corridas_por_base;
+        delete[] limites_lotes;
+        for (int t = 0; t < num_trabalhadores; t++) {
+            delete trabalhadores[t];
+        }
+        delete[] trabalhadores;
+        delete grafo;
+        
+        if (opcoes.exibir_tempos) {
+            cerr << "Tempo de construcao das corridas: " << segundosDesde(inicio_fase1) << " s" << endl;
+        }
+        
         // ==================== FASE 2: INSERÇÃO DINÂMICA ====================
         
-        double DESVIO_MAXIMO_ABSOLUTO = 1500.0; // Distância máxima de desvio aceitável
+        chrono::steady_clock::time_point inicio_fase2 = chrono::steady_clock::now();
         int demandas_inseridas_dinamicamente = 0;
         
         cerr << "\n=== INICIANDO FASE DE INSERCAO DINAMICA ===" << endl;
@@ -354,180 +292,296 @@ int main() {
         // Contar demandas individuais
         int demandas_individuais = 0;
         for (int i = 0; i < num_demandas; i++) {
-            if (demandas[i]->getEstado() == INDIVIDUAL) {
+            if (estados[i] == INDIVIDUAL) {
                 demandas_individuais++;
             }
         }
         cerr << "Demandas individuais: " << demandas_individuais << endl;
         
-        // Tentar inserir cada demanda individual em corridas compartilhadas
-        for (int i = 0; i < num_demandas; i++) {
-            // Pular demandas já combinadas
-            if (demandas[i]->getEstado() != INDIVIDUAL) {
-                continue;
-            }
-            
-            Corrida* melhor_corrida = nullptr;
-            int indice_melhor_corrida = -1;
-            double menor_custo_adicional = DESVIO_MAXIMO_ABSOLUTO + 1.0;
-            
-            // Testar inserção em todas as corridas COMPARTILHADAS
+        ParametrosFase2 parametros_insercao;
+        parametros_insercao.eta = eta;
+        parametros_insercao.gama = gama;
+        parametros_insercao.lambda = lambda;
+        parametros_insercao.desvio_maximo = DESVIO_MAXIMO_ABSOLUTO;
+        parametros_insercao.reportar_insercoes = true;
+        
+        // Índice das corridas compartilhadas com vaga, pelo último destino
+        IndiceCorridas indice_corridas(num_corridas, DESVIO_MAXIMO_ABSOLUTO);
+        bool usa_indice = !opcoes.insercao_linear && !opcoes.insercao_simulada;
+        if (usa_indice) {
             for (int j = 0; j < num_corridas; j++) {
-                Corrida* corrida_candidata = corridas[j];
-                
-                // Verificar se a corrida é compartilhada (>1 demanda)
-                if (corrida_candidata->getNumDemandas() < 2) {
-                    continue; // Pular corridas individuais
+                registrarCorridaIndice(indice_corridas, demandas, corridas.getCorrida(j), j, eta);
+            }
+        }
+        
+        // Demandas individuais, na ordem de processamento (inserir uma
+        // demanda não altera o estado das outras). Na inserção durante a
+        // simulação, elas são despachadas pelo escalonador
+        int* pendentes = new int[demandas_individuais > 0 ? demandas_individuais : 1];
+        int num_pendentes = 0;
+        for (int i = 0; i < num_demandas && !opcoes.insercao_simulada; i++) {
+            if (estados[i] == INDIVIDUAL) {
+                pendentes[num_pendentes++] = i;
+            }
+        }
+        
+        // O motor paralelo depende das consultas ao índice
+        int threads_insercao = usa_indice ? opcoes.threads : 1;
+        int reavaliacoes = 0;
+        
+        if (threads_insercao > 1) {
+            demandas_inseridas_dinamicamente = inserirEmParalelo(
+                demandas, corridas, num_corridas, indice_corridas, pendentes, num_pendentes,
+                parametros_insercao, threads_insercao, arena_execucao, arena_rascunho, reavaliacoes);
+        } else {
+            // Tentar inserir cada demanda individual em corridas compartilhadas
+            demandas_inseridas_dinamicamente = inserirSequencial(
+                demandas, corridas, num_corridas, usa_indice ? &indice_corridas : nullptr, pendentes, num_pendentes,
+                parametros_insercao, arena_execucao, arena_rascunho);
+        }
+        
+        delete[] pendentes;
+        
+        if (opcoes.exibir_tempos && !opcoes.insercao_simulada) {
+            cerr << "Fase 2: " << threads_insercao << " thread(s), " << reavaliacoes << " reavaliacao(oes), "
+                 << corridas.getEventosRedirecionados() << " evento(s) redirecionado(s), "
+                 << corridas.getPartidasReagendadas() << " partida(s) reagendada(s), "
+                 << corridas.getEventosCancelados() << " partida(s) cancelada(s)" << endl;
+        }
+        
+        if (!opcoes.insercao_simulada) {
+            imprimirResumoInsercao(demandas_inseridas_dinamicamente, demandas_individuais);
+        }
+        
+        if (opcoes.exibir_tempos) {
+            cerr << "Tempo de insercao dinamica: " << segundosDesde(inicio_fase2) << " s" << endl;
+        }
+        
+        // ==================== FIM DA INSERÇÃO DINÂMICA ====================
+        
+        // ==================== SIMULAÇÃO DE EVENTOS ====================
+        
+        chrono::steady_clock::time_point inicio_simulacao = chrono::steady_clock::now();
+        
+        int num_resultados = 0;
+        EscritorSaida escritor(cout);
+        SaidaContinua::Impressora imprimir = opcoes.escrita_iostream ? imprimirCorridaIostream : imprimirCorrida;
+        SaidaContinua saida(escritor, imprimir);
+        
+        if (!opcoes.simulacao_eventos) {
+            // Avanço direto (ver calcularConclusaoDireta), com as corridas
+            // como ficaram depois da inserção dinâmica; as individuais
+            // liberadas saem do array, na mesma ordem
+            for (int k = 0; k < num_corridas; k++) {
+                Corrida* corrida = corridas.getCorrida(k);
+                if (corrida == nullptr) {
+                    continue;
                 }
-                
-                // Verificar capacidade
-                int passageiros_atuais = corrida_candidata->getNumDemandas();
-                if (passageiros_atuais >= eta) {
-                    continue; // Corrida cheia
+                resultados[num_resultados].corrida = corrida;
+                resultados[num_resultados].tempo_conclusao = calcularConclusaoDireta(corrida,
+                                                                                     resultados[k].tempo_conclusao);
+                num_resultados++;
+            }
+        } else {
+            // As partidas entram no escalonador na ordem das corridas, só
+            // enquanto a menor partida ainda não escalonada não passa do
+            // próximo evento: com os tempos em ordem, só as corridas em
+            // andamento e a próxima partida têm eventos. menores_partidas[k]
+            // é a menor partida das corridas k em diante (as liberadas na
+            // fase 2 não partem). Os resultados preenchem o array em ordem
+            // de conclusão ou vão direto para a saída contínua
+            double* menores_partidas = new double[num_corridas + 1];
+            menores_partidas[num_corridas] = INFINITY;
+            for (int k = num_corridas - 1; k >= 0; k--) {
+                Corrida* corrida = corridas.getCorrida(k);
+                double partida = corrida != nullptr ? corrida->getTempoInicio() : INFINITY;
+                menores_partidas[k] = partida < menores_partidas[k + 1] ? partida : menores_partidas[k + 1];
+            }
+            int proxima_partida = 0;
+            auto alimentarPartidas = [&]() {
+                while (proxima_partida < num_corridas && menores_partidas[proxima_partida] != INFINITY &&
+                       (escalonador.estaVazio() ||
+                        menores_partidas[proxima_partida] <= escalonador.getTempoProximoEvento())) {
+                    int k = proxima_partida++;
+                    Corrida* corrida = corridas.getCorrida(k);
+                    if (corrida == nullptr) {
+                        continue;
+                    }
+                    TipoEvento tipo = despacho != nullptr && despacho->demanda_por_corrida[k] >= 0
+                                    ? CHEGADA_DEMANDA : COLETA_PASSAGEIRO;
+                    Evento* partida = escalonador.criaEvento(corrida->getTempoInicio(), tipo,
+                                                             corridas.getReferencia(k), 0);
+                    partida->setOrdemCorrida(k);
+                    corridas.vincularEvento(k, escalonador.insereEvento(partida));
                 }
-                
-                // Montar array de demandas da corrida atual
-                int* ids_corrida = corrida_candidata->getIdsDemandas();
-                int num_demandas_corrida = corrida_candidata->getNumDemandas();
-                
-                Demanda** demandas_corrida_temp = new Demanda*[num_demandas_corrida + 1];
-                for (int k = 0; k < num_demandas_corrida; k++) {
-                    demandas_corrida_temp[k] = demandas[ids_corrida[k]];
+            };
+            auto despacharProntas = [&]() {
+                alimentarPartidas();
+                if (despacho != nullptr && despacho->num_chegadas > 0 &&
+                    (escalonador.estaVazio() || escalonador.getTempoProximoEvento() > despacho->tempo_chegadas)) {
+                    demandas_inseridas_dinamicamente += despacharChegadas(
+                        demandas, corridas, escalonador, *despacho, parametros_insercao, arena_execucao,
+                        arena_rascunho);
                 }
-                demandas_corrida_temp[num_demandas_corrida] = demandas[i];
-                
-                // Construir corrida temporária com demanda adicional
-                double distancia_original = corrida_candidata->getDistanciaTotal();
-                double tempo_inicio = corrida_candidata->getTempoInicio();
-                
-                Corrida* corrida_temp = construirCorrida(demandas_corrida_temp, num_demandas_corrida + 1, gama, tempo_inicio);
-                double distancia_nova = corrida_temp->getDistanciaTotal();
-                double eficiencia_nova = calcularEficienciaCorrida(demandas_corrida_temp, num_demandas_corrida + 1, distancia_nova);
-                
-                // Calcular custo adicional (desvio)
-                double custo_adicional = distancia_nova - distancia_original;
+            };
+            alimentarPartidas();
+            while (!escalonador.estaVazio()) {
+                Evento* evento_atual = escalonador.retiraProximoEvento();
                 
-                // Verificar critérios
-                bool satisfaz_desvio = (custo_adicional <= DESVIO_MAXIMO_ABSOLUTO);
-                bool satisfaz_eficiencia = (eficiencia_nova >= lambda);
+                if (evento_atual == nullptr) {
+                    break;
+                }
                 
-                if (satisfaz_desvio && satisfaz_eficiencia && custo_adicional < menor_custo_adicional) {
-                    // Melhor candidata até agora
-                    if (melhor_corrida != nullptr) {
-                        delete melhor_corrida;
+                // Chegadas ficam retidas até o fim dos eventos do seu tempo
+                if (evento_atual->getTipo() == CHEGADA_DEMANDA) {
+                    if (opcoes.rastreio) {
+                        cerr << "Chegada em " << evento_atual->getTempo() << ": demanda "
+                             << demandas.getId(despacho->demanda_por_corrida[evento_atual->getOrdemCorrida()]) << endl;
                     }
-                    melhor_corrida = corrida_temp;
-                    menor_custo_adicional = custo_adicional;
-                    indice_melhor_corrida = j;
-                } else {
-                    delete corrida_temp;
+                    despacho->tempo_chegadas = evento_atual->getTempo();
+                    despacho->chegadas[despacho->num_chegadas++] = evento_atual->getOrdemCorrida();
+                    escalonador.liberaEvento(evento_atual);
+                    despacharProntas();
+                    continue;
                 }
                 
-                delete[] demandas_corrida_temp;
-            }
-            
-            // Se encontrou corrida adequada, substituir
-            if (melhor_corrida != nullptr && indice_melhor_corrida != -1) {
-                // Calcular eficiência da nova corrida
-                int* ids_nova = melhor_corrida->getIdsDemandas();
-                int num_nova = melhor_corrida->getNumDemandas();
-                Demanda** demandas_nova = new Demanda*[num_nova];
-                for (int k = 0; k < num_nova; k++) {
-                    demandas_nova[k] = demandas[ids_nova[k]];
+                ReferenciaCorrida referencia = evento_atual->getCorridaAssociada();
+                Corrida* corrida_evento = corridas.obter(referencia);
+                if (corrida_evento == nullptr) {
+                    throw EstadoInvalidoException("Evento de uma corrida substituida sem redirecionamento");
                 }
-                double eficiencia_nova = calcularEficienciaCorrida(demandas_nova, num_nova, melhor_corrida->getDistanciaTotal());
-                melhor_corrida->setEficiencia(eficiencia_nova);
-                melhor_corrida->setTempoInicio(corridas[indice_melhor_corrida]->getTempoInicio());
-                
-                // Atualizar estado da demanda inserida
-                demandas[i]->setEstado(COMBINADA);
-                demandas[i]->setCorridaAssociada(melhor_corrida);
+                int indice_parada_atual = evento_atual->getIndiceParada();
+                int total_paradas = corrida_evento->getNumParadas();
                 
-                // Atualizar estados das demandas da corrida original
-                int* ids_original = corridas[indice_melhor_corrida]->getIdsDemandas();
-                int num_original = corridas[indice_melhor_corrida]->getNumDemandas();
-                for (int k = 0; k < num_original; k++) {
-                    demandas[ids_original[k]]->setCorridaAssociada(melhor_corrida);
+                if (opcoes.rastreio) {
+                    cerr << "Evento em " << evento_atual->getTempo() << ": corrida da demanda "
+                         << corrida_evento->getIdsDemandas()[0] << ", parada " << (indice_parada_atual + 1)
+                         << " de " << total_paradas << endl;
                 }
                 
-                // Substituir corrida antiga pela nova
-                delete corridas[indice_melhor_corrida];
-                corridas[indice_melhor_corrida] = melhor_corrida;
-                
-                demandas_inseridas_dinamicamente++;
+                // Uma corrida compartilhada fica ativa da partida até a
+                // última parada
+                if (despacho != nullptr && indice_parada_atual == 0) {
+                    despacho->atualizarAtiva(corrida_evento, referencia.indice, eta, true);
+                }
                 
-                cerr << "Demanda " << demandas[i]->getId() << " inserida na corrida " << indice_melhor_corrida 
-                     << " (desvio: " << menor_custo_adicional << ")" << endl;
+                // Se for a última parada, armazenar resultado
+                if (indice_parada_atual >= total_paradas - 1) {
+                    if (despacho != nullptr) {
+                        despacho->atualizarAtiva(corrida_evento, referencia.indice, eta, false);
+                    }
+                    double tempo_conclusao = evento_atual->getTempo();
+                    if (opcoes.saida_continua) {
+                        saida.registrar(tempo_conclusao, evento_atual->getOrdemCorrida(), corrida_evento);
+                    } else {
+                        resultados[num_resultados].tempo_conclusao = tempo_conclusao;
+                        resultados[num_resultados].corrida = corrida_evento;
+                    }
+                    num_resultados++;
+                } else {
+                    // Escalonar próxima parada
+                    Trecho* trechos = corrida_evento->getTrechos();
+                    double tempo_proximo = evento_atual->getTempo() + trechos[indice_parada_atual].getTempo();
+                    
+                    Evento* proximo_evento = escalonador.criaEvento(tempo_proximo, COLETA_PASSAGEIRO, referencia,
+                                                                    indice_parada_atual + 1);
+                    proximo_evento->setOrdemCorrida(evento_atual->getOrdemCorrida());
+                    corridas.vincularEvento(referencia.indice, escalonador.insereEvento(proximo_evento));
+                }
                 
-                delete[] demandas_nova;
+                escalonador.liberaEvento(evento_atual);
+                despacharProntas();
             }
+            saida.finalizar();
         }
         
-        cerr << "\n=== RESUMO DA INSERCAO DINAMICA ===" << endl;
-        cerr << "Demandas inseridas dinamicamente: " << demandas_inseridas_dinamicamente << endl;
-        cerr << "Taxa de insercao: " << (100.0 * demandas_inseridas_dinamicamente / demandas_individuais) << "%" << endl;
-        cerr << endl;
-        
-        // ==================== FIM DA INSERÇÃO DINÂMICA ====================
-        
-        // ==================== SIMULAÇÃO DE EVENTOS ====================
+        if (despacho != nullptr) {
+            imprimirResumoInsercao(demandas_inseridas_dinamicamente, demandas_individuais);
+        }
         
-        // Array para armazenar resultados
-        ResultadoCorrida* resultados = new ResultadoCorrida[num_corridas];
-        int num_resultados = 0;
+        if (opcoes.exibir_tempos) {
+            if (opcoes.simulacao_eventos) {
+                cerr << "Tempo de simulacao: " << segundosDesde(inicio_simulacao) << " s ("
+                     << escalonador.getNomeFila() << ", " << escalonador.getTotalEventosProcessados() << " eventos, "
+                     << escalonador.getPool().getPicoVivos() << " vivos no pico)" << endl;
+            } else {
+                cerr << "Tempo de simulacao: " << segundosDesde(inicio_simulacao) << " s (avanco direto, "
+                     << num_corridas << " corridas)" << endl;
+            }
+            if (despacho != nullptr) {
+                cerr << "Insercao durante a simulacao: " << despacho->total_chegadas << " chegada(s), "
+                     << despacho->total_inseridas << " insercao(oes), " << despacho->candidatas_avaliadas
+                     << " candidata(s) avaliada(s), maximo de " << despacho->maior_num_ativas
+                     << " corrida(s) ativa(s)" << endl;
+            }
+            const FilaCalendario* calendario = escalonador.getCalendario();
+            if (calendario != nullptr && opcoes.simulacao_eventos) {
+                cerr << "Calendario: " << calendario->getRedimensionamentos() << " redimensionamento(s), "
+                     << calendario->getBuscasDiretas() << " busca(s) direta(s), largura final "
+                     << calendario->getLargura() << endl;
+            }
+        }
         
-        while (!escalonador.estaVazio()) {
-            Evento* evento_atual = escalonador.retiraProximoEvento();
-            
-            if (evento_atual == nullptr) {
-                break;
+        if (opcoes.saida_continua) {
+            if (opcoes.exibir_tempos) {
+                cerr << "Saida continua: " << saida.getTotalEscritas() << " corrida(s), maior buffer de empates "
+                     << saida.getMaiorBuffer() << ", " << saida.getForaDeOrdem() << " fora de ordem" << endl;
             }
+        } else {
+            chrono::steady_clock::time_point inicio_saida = chrono::steady_clock::now();
             
-            Corrida* corrida_evento = evento_atual->getCorridaAssociada();
-            int indice_parada_atual = evento_atual->getIndiceParada();
-            int total_paradas = corrida_evento->getNumParadas();
+            // Ordenar resultados por tempo de conclusão (radix sort estável)
+            OrdenadorResultados ordenador(opcoes.threads);
+            ordenador.ordenar(resultados, num_resultados);
+            if (opcoes.exibir_tempos) {
+                cerr << "Tempo de ordenacao: " << segundosDesde(inicio_saida) << " s ("
+                     << ordenador.getPassadasExecutadas() << " passada(s), "
+                     << ordenador.getPassadasPuladas() << " pulada(s))" << endl;
+            }
             
-            // Se for a última parada, armazenar resultado
-            if (indice_parada_atual >= total_paradas - 1) {
-                double tempo_conclusao = evento_atual->getTempo();
-                resultados[num_resultados].tempo_conclusao = tempo_conclusao;
-                resultados[num_resultados].corrida = corrida_evento;
-                num_resultados++;
+            // Imprimir resultados ordenados
+            if (opcoes.formato_binario) {
+                SaidaBinaria saida_binaria(escritor);
+                saida_binaria.escrever(resultados, num_resultados);
             } else {
-                // Escalonar próxima parada
-                Trecho** trechos = corrida_evento->getTrechos();
-                double tempo_proximo = evento_atual->getTempo() + trechos[indice_parada_atual]->getTempo();
-                
-                Evento* proximo_evento = new Evento(tempo_proximo, COLETA_PASSAGEIRO, corrida_evento, indice_parada_atual + 1);
-                escalonador.insereEvento(proximo_evento);
+                for (int i = 0; i < num_resultados; i++) {
+                    imprimir(escritor, resultados[i].corrida, resultados[i].tempo_conclusao);
+                }
             }
             
-            delete evento_atual;
+            escritor.descarregar();
+            
+            delete[] resultados;
+            
+            if (opcoes.exibir_tempos) {
+                cerr << "Tempo de ordenacao e saida: " << segundosDesde(inicio_saida) << " s" << endl;
+            }
         }
-        
-        // Ordenar resultados por tempo de conclusão (QuickSort implementado manualmente)
-        ordenarResultados(resultados, num_resultados);
-        
-        // Imprimir resultados ordenados
-        for (int i = 0; i < num_resultados; i++) {
-            imprimirCorrida(resultados[i].corrida, resultados[i].tempo_conclusao);
+        escritor.descarregar();
+        if (opcoes.exibir_tempos && !opcoes.escrita_iostream) {
+            cerr << "Escrita: " << escritor.getBytesEscritos() << " bytes em "
+                 << escritor.getDescargas() << " descarga(s)" << endl;
         }
         
-        delete[] resultados;
-        
         // ==================== LIMPEZA DE MEMÓRIA ====================
         
         escalonador.finaliza();
+        delete despacho;
         
-        for (int i = 0; i < num_corridas; i++) {
-            delete corridas[i];
-        }
-        delete[] corridas;
+        // Corridas, paradas e trechos são liberados com as arenas, e os eventos
+        // com o pool do escalonador
         
-        for (int i = 0; i < num_demandas; i++) {
-            delete demandas[i];
+        if (opcoes.exibir_tempos) {
+            cerr << "=== ESTATISTICAS DE ALOCACAO ===" << endl;
+            imprimirEstatisticasArena("Arena da execucao", arena_execucao);
+            imprimirEstatisticasArena("Arena de rascunho", arena_rascunho);
+            imprimirEstatisticasPool("Pool de eventos", escalonador.getPool());
+            for (int t = 1; t < num_trabalhadores; t++) {
+                string nome = "Arena da fase 1 (thread " + to_string(t) + ")";
+                imprimirEstatisticasArena(nome.c_str(), arenas_trabalhadores[2 * (t - 1)]);
+            }
         }
-        delete[] demandas;
+        delete[] arenas_trabalhadores;
         
         return 0;
         
@@ -0,0 +1,150 @@
+#include "ModoOnline.hpp"
+#include "ConstrucaoCorridas.hpp"
+#include "EntradaDemandas.hpp"
+#include "Escalonador.hpp"
+#include "EscritorSaida.hpp"
+#include "GeracoesOnline.hpp"
+#include "Relatorios.hpp"
+#include "SaidaContinua.hpp"
+#include "SimulacaoException.hpp"
+#include "TabelaCorridas.hpp"
+#include <chrono>
+#include <iostream>
+#include <string>
+
+// Demandas já agrupadas só são removidas do store em blocos de ao menos
+// este tamanho (e quando são ao menos metade dele)
+static const int DESCARTE_MINIMO_ONLINE = 4096;
+
+// Escreve, em ordem de conclusão, as corridas pendentes que concluem até
+// marca_dagua (inclusive); o índice de cada corrida escrita volta à tabela
+static void escreverConcluidas(Escalonador& pendentes, TabelaCorridas& corridas, GeracoesOnline& geracoes,
+                               SaidaContinua& saida, double marca_dagua, bool ate_o_fim) {
+    while (!pendentes.estaVazio() && (ate_o_fim || pendentes.getTempoProximoEvento() <= marca_dagua)) {
+        Evento* evento = pendentes.retiraProximoEvento();
+        ReferenciaCorrida referencia = evento->getCorridaAssociada();
+        saida.registrar(evento->getTempo(), evento->getOrdemCorrida(), corridas.obter(referencia));
+        corridas.liberar(referencia.indice);
+        geracoes.liberarCorrida(referencia.indice);
+        pendentes.liberaEvento(evento);
+    }
+}
+
+// Processa a entrada como um fluxo em ordem de tempo, com memória
+// proporcional à janela ativa. A demanda i vira base assim que foi lida
+// uma demanda com tempo >= tempo(i) + delta (ou a entrada acabou): todas
+// as suas candidatas já estão no store, e a corrida formada é a mesma da
+// fase 1 em lote. A conclusão é calculada como no avanço direto e a
+// corrida fica pendente até a marca d'água (tempo da última base), pois
+// nenhuma corrida futura conclui antes dela. Demandas anteriores à
+// próxima base saem do store; gerações de arena inteiramente escritas são
+// reaproveitadas. Não há inserção dinâmica: a fase 2 compara cada demanda
+// individual com todas as corridas do dia, o que não cabe numa janela
+// limitada. A saída é a das corridas da fase 1, e difere da execução em
+// lote quando a fase 2 encontra inserções
+void executarOnline(LeitorEntrada* leitor, int num_demandas, const ParametrosFase1& parametros,
+                    const OpcoesExecucao& opcoes) {
+    std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+    
+    std::cerr << "Aviso: --online nao faz a insercao dinamica (fase 2); "
+              << "as corridas podem diferir da execucao em lote" << std::endl;
+    
+    DemandaStore demandas(DESCARTE_MINIMO_ONLINE);
+    Arena arena_rascunho;
+    GeracoesOnline geracoes;
+    TrabalhadorFase1 trabalhador(&demandas, parametros, opcoes.isa, geracoes.getArenaAtual(), &arena_rascunho);
+    Escalonador pendentes(DESCARTE_MINIMO_ONLINE, nullptr, opcoes.fila);
+    pendentes.inicializa();
+    TabelaCorridas corridas(DESCARTE_MINIMO_ONLINE, nullptr);
+    
+    EscritorSaida escritor(std::cout);
+    SaidaContinua::Impressora imprimir = opcoes.escrita_iostream ? imprimirCorridaIostream : imprimirCorrida;
+    SaidaContinua saida(escritor, imprimir);
+    
+    int lidas = 0;
+    int proxima_base = 0;
+    int num_corridas = 0;
+    int maior_janela = 0;
+    int maior_pendencia = 0;
+    int descartes = 0;
+    double ultimo_tempo = 0.0;
+    
+    while (true) {
+        // Agrupar as bases cuja janela já está completa
+        while (proxima_base < demandas.getTamanho()) {
+            const double* tempos = demandas.getTempos();
+            int i = proxima_base;
+            if (lidas < num_demandas && !(tempos[demandas.getTamanho() - 1] - tempos[i] >= parametros.delta)) {
+                break;
+            }
+            
+            if (demandas.getEstado(i) == DEMANDADA) {
+                trabalhador.arena = geracoes.getArenaAtual();
+                Corrida* corrida = agruparBase(demandas, parametros, trabalhador, i, demandas.getTamanho());
+                double tempo = calcularConclusaoDireta(corrida, tempos[i]);
+                
+                ReferenciaCorrida referencia = corridas.registrar(corrida);
+                Evento* conclusao = pendentes.criaEvento(tempo, COLETA_PASSAGEIRO, referencia, 0);
+                conclusao->setOrdemCorrida(num_corridas++);
+                pendentes.insereEvento(conclusao);
+                geracoes.registrarCorrida(referencia.indice);
+                if (pendentes.getTamanho() > maior_pendencia) {
+                    maior_pendencia = pendentes.getTamanho();
+                }
+            }
+            proxima_base++;
+            
+            escreverConcluidas(pendentes, corridas, geracoes, saida, tempos[i], false);
+        }
+        
+        // Demandas antes da próxima base não são mais candidatas
+        if (proxima_base >= DESCARTE_MINIMO_ONLINE && 2 * proxima_base >= demandas.getTamanho()) {
+            demandas.descartarPrimeiras(proxima_base);
+            proxima_base = 0;
+            descartes++;
+        }
+        
+        if (lidas == num_demandas) {
+            break;
+        }
+        
+        int id;
+        double tempo, ox, oy, dx, dy;
+        if (!(lerValor(leitor, id) && lerValor(leitor, tempo) && lerValor(leitor, ox) &&
+              lerValor(leitor, oy) && lerValor(leitor, dx) && lerValor(leitor, dy))) {
+            std::string mensagem = "Demanda " + std::to_string(lidas) + " ausente ou malformada";
+            if (leitor != nullptr) {
+                mensagem += " (linha " + std::to_string(leitor->getLinha()) + ")";
+            }
+            throw DemandaInvalidaException(mensagem);
+        }
+        if (lidas > 0 && !(tempo >= ultimo_tempo)) {
+            throw DemandaInvalidaException("Modo online requer demandas em ordem de tempo (demanda " +
+                                           std::to_string(lidas) + ")");
+        }
+        
+        demandas.adicionar(id, tempo, ox, oy, dx, dy);
+        ultimo_tempo = tempo;
+        lidas++;
+        if (demandas.getTamanho() - proxima_base > maior_janela) {
+            maior_janela = demandas.getTamanho() - proxima_base;
+        }
+    }
+    
+    escreverConcluidas(pendentes, corridas, geracoes, saida, 0.0, true);
+    saida.finalizar();
+    escritor.descarregar();
+    
+    if (opcoes.exibir_tempos) {
+        std::cerr << "Modo online: " << lidas << " demandas, " << num_corridas << " corridas em "
+                  << segundosDesde(inicio) << " s" << std::endl;
+        std::cerr << "Janela: pico de " << maior_janela << " demandas ativas, " << maior_pendencia
+                  << " corridas pendentes, " << descartes << " descarte(s) do store" << std::endl;
+        std::cerr << "Geracoes de arena: " << geracoes.getNumGeracoes() << " criadas, pico de "
+                  << geracoes.getPicoEmUso() << " em uso, " << geracoes.getBytesReservados() << " bytes reservados"
+                  << std::endl;
+        imprimirEstatisticasPool("Pool de eventos", pendentes.getPool());
+    }
+    
+    pendentes.finaliza();
+}
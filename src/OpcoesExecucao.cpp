@@ -0,0 +1,141 @@
+#include "OpcoesExecucao.hpp"
+#include "SimulacaoException.hpp"
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+OpcoesExecucao lerOpcoes(int argc, char** argv) {
+    OpcoesExecucao opcoes;
+    opcoes.leitura_stream = false;
+    opcoes.somente_leitura = false;
+    opcoes.exibir_tempos = false;
+    opcoes.avaliacao_reconstrucao = false;
+    opcoes.indice_linear = false;
+    opcoes.isa = ISA_AUTOMATICO;
+    opcoes.threads = 1;
+    opcoes.insercao_linear = false;
+    opcoes.insercao_simulada = false;
+    opcoes.fila = FILA_HEAP;
+    opcoes.simulacao_eventos = false;
+    opcoes.rastreio = false;
+    opcoes.saida_continua = false;
+    opcoes.escrita_iostream = false;
+    opcoes.formato_binario = false;
+    opcoes.online = false;
+    opcoes.varredura = nullptr;
+    opcoes.compatibilidade = COMPATIBILIDADE_AUTOMATICA;
+    opcoes.cenarios_individuais = false;
+    
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--leitura=stream") == 0) {
+            opcoes.leitura_stream = true;
+        } else if (strcmp(argv[i], "--leitura=rapida") == 0) {
+            opcoes.leitura_stream = false;
+        } else if (strcmp(argv[i], "--somente-leitura") == 0) {
+            opcoes.somente_leitura = true;
+        } else if (strcmp(argv[i], "--avaliacao=reconstrucao") == 0) {
+            opcoes.avaliacao_reconstrucao = true;
+        } else if (strcmp(argv[i], "--avaliacao=incremental") == 0) {
+            opcoes.avaliacao_reconstrucao = false;
+        } else if (strcmp(argv[i], "--indice=linear") == 0) {
+            opcoes.indice_linear = true;
+        } else if (strcmp(argv[i], "--indice=grade") == 0) {
+            opcoes.indice_linear = false;
+        } else if (strcmp(argv[i], "--simd=auto") == 0) {
+            opcoes.isa = ISA_AUTOMATICO;
+        } else if (strcmp(argv[i], "--simd=avx2") == 0) {
+            opcoes.isa = ISA_AVX2;
+        } else if (strcmp(argv[i], "--simd=sse2") == 0) {
+            opcoes.isa = ISA_SSE2;
+        } else if (strcmp(argv[i], "--simd=escalar") == 0) {
+            opcoes.isa = ISA_ESCALAR;
+        } else if (strncmp(argv[i], "--threads=", 10) == 0) {
+            char* fim = nullptr;
+            long threads = strtol(argv[i] + 10, &fim, 10);
+            if (fim == argv[i] + 10 || *fim != '\0' || threads < 1 || threads > 1024) {
+                throw ParametroInvalidoException(std::string("Numero de threads invalido: ") + argv[i]);
+            }
+            opcoes.threads = static_cast<int>(threads);
+        } else if (strcmp(argv[i], "--insercao=linear") == 0) {
+            opcoes.insercao_linear = true;
+            opcoes.insercao_simulada = false;
+        } else if (strcmp(argv[i], "--insercao=indice") == 0) {
+            opcoes.insercao_linear = false;
+            opcoes.insercao_simulada = false;
+        } else if (strcmp(argv[i], "--insercao=eventos") == 0) {
+            opcoes.insercao_linear = false;
+            opcoes.insercao_simulada = true;
+        } else if (strcmp(argv[i], "--fila=heap") == 0) {
+            opcoes.fila = FILA_HEAP;
+        } else if (strcmp(argv[i], "--fila=calendario") == 0) {
+            opcoes.fila = FILA_CALENDARIO;
+        } else if (strcmp(argv[i], "--simulacao=eventos") == 0) {
+            opcoes.simulacao_eventos = true;
+        } else if (strcmp(argv[i], "--simulacao=direta") == 0) {
+            opcoes.simulacao_eventos = false;
+        } else if (strcmp(argv[i], "--saida=continua") == 0) {
+            opcoes.saida_continua = true;
+        } else if (strcmp(argv[i], "--saida=ordenada") == 0) {
+            opcoes.saida_continua = false;
+        } else if (strcmp(argv[i], "--escrita=iostream") == 0) {
+            opcoes.escrita_iostream = true;
+        } else if (strcmp(argv[i], "--escrita=buffer") == 0) {
+            opcoes.escrita_iostream = false;
+        } else if (strcmp(argv[i], "--formato=binario") == 0) {
+            opcoes.formato_binario = true;
+        } else if (strcmp(argv[i], "--formato=texto") == 0) {
+            opcoes.formato_binario = false;
+        } else if (strcmp(argv[i], "--online") == 0) {
+            opcoes.online = true;
+        } else if (strcmp(argv[i], "--compatibilidade=automatica") == 0) {
+            opcoes.compatibilidade = COMPATIBILIDADE_AUTOMATICA;
+        } else if (strcmp(argv[i], "--compatibilidade=direta") == 0) {
+            opcoes.compatibilidade = COMPATIBILIDADE_DIRETA;
+        } else if (strcmp(argv[i], "--compatibilidade=grafo") == 0) {
+            opcoes.compatibilidade = COMPATIBILIDADE_GRAFO;
+        } else if (strcmp(argv[i], "--cenarios=vetorizados") == 0) {
+            opcoes.cenarios_individuais = false;
+        } else if (strcmp(argv[i], "--cenarios=individuais") == 0) {
+            opcoes.cenarios_individuais = true;
+        } else if (strncmp(argv[i], "--varredura=", 12) == 0 && argv[i][12] != '\0') {
+            opcoes.varredura = argv[i] + 12;
+        } else if (strcmp(argv[i], "--rastreio") == 0) {
+            opcoes.rastreio = true;
+        } else if (strcmp(argv[i], "--tempos") == 0) {
+            opcoes.exibir_tempos = true;
+        } else {
+            throw ParametroInvalidoException(std::string("Opcao desconhecida: ") + argv[i]);
+        }
+    }
+    
+    // As colunas só podem ser gravadas com todos os resultados em mãos
+    if (opcoes.formato_binario && (opcoes.saida_continua || opcoes.online)) {
+        throw ParametroInvalidoException("--formato=binario nao pode ser usado com --saida=continua ou --online");
+    }
+    
+    // O modo online calcula as conclusões diretamente, sem eventos por parada
+    if (opcoes.online && (opcoes.rastreio || opcoes.simulacao_eventos || opcoes.insercao_simulada)) {
+        throw ParametroInvalidoException("--online nao pode ser usado com --rastreio, --simulacao=eventos "
+                                         "ou --insercao=eventos");
+    }
+    
+    // A varredura só emite as métricas de cada configuração
+    if (opcoes.varredura != nullptr && (opcoes.formato_binario || opcoes.saida_continua || opcoes.online ||
+                                        opcoes.rastreio || opcoes.somente_leitura || opcoes.insercao_simulada)) {
+        throw ParametroInvalidoException("--varredura nao pode ser usado com --formato=binario, --saida=continua, "
+                                         "--online, --rastreio, --somente-leitura ou --insercao=eventos");
+    }
+    
+    // O modo online descarta as demandas já agrupadas, e o grafo é de todas
+    if (opcoes.online && opcoes.compatibilidade == COMPATIBILIDADE_GRAFO) {
+        throw ParametroInvalidoException("--online nao pode ser usado com --compatibilidade=grafo");
+    }
+    
+    // O rastreio, a saída contínua e a inserção durante a simulação
+    // dependem dos eventos de cada parada
+    if (opcoes.rastreio || opcoes.saida_continua || opcoes.insercao_simulada) {
+        opcoes.simulacao_eventos = true;
+    }
+    
+    return opcoes;
+}
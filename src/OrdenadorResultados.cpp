@@ -0,0 +1,205 @@
+#include "OrdenadorResultados.hpp"
+#include <cstring>
+#include <thread>
+
+static const int BITS_DIGITO = 8;
+static const int RAIZ = 1 << BITS_DIGITO;
+static const int NUM_PASSADAS = 64 / BITS_DIGITO;
+
+// Elementos mínimos por thread na ordenação paralela
+static const int MINIMO_POR_THREAD = 1 << 16;
+
+static inline int digito(uint64_t chave, int passada) {
+    return static_cast<int>((chave >> (passada * BITS_DIGITO)) & (RAIZ - 1));
+}
+
+// Construtor
+OrdenadorResultados::OrdenadorResultados(int threads) {
+    this->threads = threads > 0 ? threads : 1;
+    this->passadas_executadas = 0;
+    this->passadas_puladas = 0;
+}
+
+// Operações principais
+void OrdenadorResultados::ordenar(ResultadoCorrida* resultados, int tamanho) {
+    this->passadas_executadas = 0;
+    this->passadas_puladas = 0;
+    if (tamanho < 2) {
+        return;
+    }
+
+    Item* itens = new Item[tamanho];
+    Item* auxiliar = new Item[tamanho];
+    for (int i = 0; i < tamanho; i++) {
+        itens[i].chave = chaveOrdenavel(resultados[i].tempo_conclusao);
+        itens[i].corrida = resultados[i].corrida;
+    }
+
+    int num_threads = this->threads;
+    if (num_threads > tamanho / MINIMO_POR_THREAD) {
+        num_threads = tamanho / MINIMO_POR_THREAD;
+    }
+
+    Item* ordenados;
+    if (tamanho >= MINIMO_PARALELO && num_threads > 1) {
+        ordenarParalelo(itens, auxiliar, tamanho, num_threads, &ordenados);
+    } else {
+        ordenarSequencial(itens, auxiliar, tamanho, &ordenados);
+    }
+
+    for (int i = 0; i < tamanho; i++) {
+        resultados[i].tempo_conclusao = tempoDaChave(ordenados[i].chave);
+        resultados[i].corrida = ordenados[i].corrida;
+    }
+
+    delete[] itens;
+    delete[] auxiliar;
+}
+
+// Getters
+int OrdenadorResultados::getPassadasExecutadas() const {
+    return this->passadas_executadas;
+}
+
+int OrdenadorResultados::getPassadasPuladas() const {
+    return this->passadas_puladas;
+}
+
+uint64_t OrdenadorResultados::chaveOrdenavel(double tempo) {
+    uint64_t bits;
+    memcpy(&bits, &tempo, sizeof(bits));
+    if (bits >> 63) {
+        return ~bits;
+    }
+    return bits | (1ULL << 63);
+}
+
+double OrdenadorResultados::tempoDaChave(uint64_t chave) {
+    uint64_t bits = (chave >> 63) ? (chave & ~(1ULL << 63)) : ~chave;
+    double tempo;
+    memcpy(&tempo, &bits, sizeof(tempo));
+    return tempo;
+}
+
+// Métodos privados
+
+// Os histogramas das 8 passadas saem de uma única leitura: a contagem de
+// cada dígito não depende da ordem dos elementos
+void OrdenadorResultados::ordenarSequencial(Item* itens, Item* auxiliar, int tamanho, Item** resultado) {
+    int (*contagens)[RAIZ] = new int[NUM_PASSADAS][RAIZ];
+    memset(contagens, 0, sizeof(int) * NUM_PASSADAS * RAIZ);
+    for (int i = 0; i < tamanho; i++) {
+        uint64_t chave = itens[i].chave;
+        for (int p = 0; p < NUM_PASSADAS; p++) {
+            contagens[p][digito(chave, p)]++;
+        }
+    }
+
+    Item* origem = itens;
+    Item* destino = auxiliar;
+    for (int p = 0; p < NUM_PASSADAS; p++) {
+        int* contagem = contagens[p];
+        if (contagem[digito(origem[0].chave, p)] == tamanho) {
+            this->passadas_puladas++;
+            continue;
+        }
+
+        int posicao = 0;
+        for (int d = 0; d < RAIZ; d++) {
+            int quantidade = contagem[d];
+            contagem[d] = posicao;
+            posicao += quantidade;
+        }
+        for (int i = 0; i < tamanho; i++) {
+            destino[contagem[digito(origem[i].chave, p)]++] = origem[i];
+        }
+
+        Item* temporario = origem;
+        origem = destino;
+        destino = temporario;
+        this->passadas_executadas++;
+    }
+
+    delete[] contagens;
+    *resultado = origem;
+}
+
+// Cada thread fica com uma faixa contígua do array. Numa passada, as threads
+// contam os dígitos da sua faixa; a posição inicial de (dígito d, faixa t) é
+// a soma de todos os dígitos menores mais os dígitos d das faixas
+// anteriores, o que mantém a estabilidade; depois cada thread distribui a
+// sua faixa a partir dessas posições
+void OrdenadorResultados::ordenarParalelo(Item* itens, Item* auxiliar, int tamanho, int num_threads,
+                                          Item** resultado) {
+    int* inicios = new int[num_threads + 1];
+    for (int t = 0; t <= num_threads; t++) {
+        inicios[t] = static_cast<int>(static_cast<long long>(tamanho) * t / num_threads);
+    }
+    int* contagens = new int[num_threads * RAIZ];
+    std::thread* trabalhadores = new std::thread[num_threads - 1];
+
+    Item* origem = itens;
+    Item* destino = auxiliar;
+    for (int p = 0; p < NUM_PASSADAS; p++) {
+        auto contar = [&](int t) {
+            int* contagem = contagens + t * RAIZ;
+            for (int d = 0; d < RAIZ; d++) {
+                contagem[d] = 0;
+            }
+            for (int i = inicios[t]; i < inicios[t + 1]; i++) {
+                contagem[digito(origem[i].chave, p)]++;
+            }
+        };
+        for (int t = 1; t < num_threads; t++) {
+            trabalhadores[t - 1] = std::thread(contar, t);
+        }
+        contar(0);
+        for (int t = 1; t < num_threads; t++) {
+            trabalhadores[t - 1].join();
+        }
+
+        // Converte as contagens em posições iniciais (dígito maior, faixa menor)
+        int posicao = 0;
+        bool pular = false;
+        for (int d = 0; d < RAIZ; d++) {
+            int total_digito = 0;
+            for (int t = 0; t < num_threads; t++) {
+                int quantidade = contagens[t * RAIZ + d];
+                contagens[t * RAIZ + d] = posicao;
+                posicao += quantidade;
+                total_digito += quantidade;
+            }
+            if (total_digito == tamanho) {
+                pular = true;
+            }
+        }
+        if (pular) {
+            this->passadas_puladas++;
+            continue;
+        }
+
+        auto distribuir = [&](int t) {
+            int* posicoes = contagens + t * RAIZ;
+            for (int i = inicios[t]; i < inicios[t + 1]; i++) {
+                destino[posicoes[digito(origem[i].chave, p)]++] = origem[i];
+            }
+        };
+        for (int t = 1; t < num_threads; t++) {
+            trabalhadores[t - 1] = std::thread(distribuir, t);
+        }
+        distribuir(0);
+        for (int t = 1; t < num_threads; t++) {
+            trabalhadores[t - 1].join();
+        }
+
+        Item* temporario = origem;
+        origem = destino;
+        destino = temporario;
+        this->passadas_executadas++;
+    }
+
+    delete[] trabalhadores;
+    delete[] contagens;
+    delete[] inicios;
+    *resultado = origem;
+}
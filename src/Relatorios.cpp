@@ -0,0 +1,88 @@
+#include "Relatorios.hpp"
+#include "Arena.hpp"
+#include "Corrida.hpp"
+#include "EscritorSaida.hpp"
+#include "EventoPool.hpp"
+#include "GrafoCompatibilidade.hpp"
+#include "Parada.hpp"
+#include <iomanip>
+#include <iostream>
+
+double segundosDesde(std::chrono::steady_clock::time_point inicio) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+}
+
+void imprimirCorrida(EscritorSaida& escritor, Corrida* corrida, double tempo_conclusao) {
+    // Formato: <tempo_conclusão> <distância_total> <eficiência> <num_paradas> <x1> <y1> <x2> <y2> ...
+    escritor.escreverDecimal2(tempo_conclusao);
+    escritor.escreverCaractere(' ');
+    escritor.escreverDecimal2(corrida->getDistanciaTotal());
+    escritor.escreverCaractere(' ');
+    escritor.escreverDecimal2(corrida->getEficiencia());
+    escritor.escreverCaractere(' ');
+    escritor.escreverInteiro(corrida->getNumParadas());
+    
+    Parada* paradas = corrida->getParadas();
+    for (int i = 0; i < corrida->getNumParadas(); i++) {
+        escritor.escreverCaractere(' ');
+        escritor.escreverDecimal2(paradas[i].getCoordX());
+        escritor.escreverCaractere(' ');
+        escritor.escreverDecimal2(paradas[i].getCoordY());
+    }
+    escritor.escreverCaractere('\n');
+}
+
+// Formatação original, por operator<< e com endl a cada linha (referência
+// para comparar com o EscritorSaida)
+void imprimirCorridaIostream(EscritorSaida& escritor, Corrida* corrida, double tempo_conclusao) {
+    (void)escritor;
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << tempo_conclusao << " ";
+    std::cout << corrida->getDistanciaTotal() << " ";
+    std::cout << corrida->getEficiencia() << " ";  // ← ADICIONADO
+    std::cout << corrida->getNumParadas();
+    
+    Parada* paradas = corrida->getParadas();
+    for (int i = 0; i < corrida->getNumParadas(); i++) {
+        std::cout << " " << paradas[i].getCoordX() << " " << paradas[i].getCoordY();
+    }
+    std::cout << std::endl;
+}
+
+void imprimirResumoInsercao(int demandas_inseridas, int demandas_individuais) {
+    std::cerr << "\n=== RESUMO DA INSERCAO DINAMICA ===" << std::endl;
+    std::cerr << "Demandas inseridas dinamicamente: " << demandas_inseridas << std::endl;
+    std::cerr << "Taxa de insercao: " << (100.0 * demandas_inseridas / demandas_individuais) << "%" << std::endl;
+    std::cerr << std::endl;
+}
+
+void imprimirEstatisticasArena(const char* nome, const Arena& arena) {
+    std::cerr << nome << ": " << arena.getTotalAlocacoes() << " alocacoes, "
+              << arena.getBytesEmUso() << " bytes em uso, pico de " << arena.getPicoBytes()
+              << " bytes, " << arena.getBytesReservados() << " bytes reservados, "
+              << arena.getTotalReinicios() << " reinicios" << std::endl;
+}
+
+void imprimirEstatisticasGrafo(const GrafoCompatibilidade& grafo, double segundos) {
+    std::cerr << "Grafo de compatibilidade: " << grafo.getNumArestas() << " arestas em " << segundos << " s"
+              << std::endl;
+}
+
+// Um grafo desabilitado é sempre reportado: as distâncias voltam a ser
+// calculadas pela grade/verificador, o que muda o custo da execução
+void avisarGrafoDesabilitado(const GrafoCompatibilidade& grafo) {
+    std::cerr << "Grafo de compatibilidade desabilitado (";
+    if (grafo.excedeuArestas()) {
+        std::cerr << "mais de " << GrafoCompatibilidade::MAXIMO_ARESTAS << " arestas";
+    } else {
+        std::cerr << "tempos fora de ordem";
+    }
+    std::cerr << "): distancias calculadas diretamente" << std::endl;
+}
+
+void imprimirEstatisticasPool(const char* nome, const EventoPool& pool) {
+    std::cerr << nome << ": " << pool.getEventosCriados() << " eventos, " << pool.getEventosVivos()
+              << " vivos, pico de " << pool.getPicoVivos() << ", " << pool.getEventosReciclados()
+              << " reciclados, " << pool.getTotalSlabs() << " blocos (" << pool.getBytesReservados()
+              << " bytes reservados)" << std::endl;
+}
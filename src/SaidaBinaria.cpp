@@ -0,0 +1,110 @@
+#include "SaidaBinaria.hpp"
+#include "Corrida.hpp"
+#include "EscritorSaida.hpp"
+#include "FormatoSaidaBinaria.hpp"
+#include <cstring>
+
+using namespace FormatoSaidaBinaria;
+
+static uint64_t alinhar(uint64_t deslocamento) {
+    return (deslocamento + ALINHAMENTO - 1) / ALINHAMENTO * ALINHAMENTO;
+}
+
+static void preencherDescritor(DescritorColuna& descritor, const char* nome, TipoColuna tipo, uint32_t largura,
+                               uint64_t elementos, uint64_t& deslocamento) {
+    memset(&descritor, 0, sizeof(descritor));
+    strncpy(descritor.nome, nome, TAMANHO_NOME - 1);
+    descritor.tipo = tipo;
+    descritor.largura = largura;
+    descritor.deslocamento = deslocamento;
+    descritor.elementos = elementos;
+    deslocamento = alinhar(deslocamento + largura * elementos);
+}
+
+// Construtor
+SaidaBinaria::SaidaBinaria(EscritorSaida& escritor) : escritor(escritor) {
+    this->bytes_gravados = 0;
+}
+
+// Operações principais
+void SaidaBinaria::escrever(const ResultadoCorrida* resultados, int num_resultados) {
+    uint64_t n = num_resultados > 0 ? static_cast<uint64_t>(num_resultados) : 0;
+    uint64_t total_paradas = 0;
+    for (uint64_t i = 0; i < n; i++) {
+        total_paradas += static_cast<uint64_t>(resultados[i].corrida->getNumParadas());
+    }
+
+    Cabecalho cabecalho;
+    memset(&cabecalho, 0, sizeof(cabecalho));
+    memcpy(cabecalho.magica, MAGICA, sizeof(MAGICA));
+    cabecalho.versao = VERSAO;
+    cabecalho.marca_ordem = MARCA_ORDEM;
+    cabecalho.num_corridas = n;
+    cabecalho.total_paradas = total_paradas;
+    cabecalho.num_colunas = NUM_COLUNAS;
+    cabecalho.tamanho_cabecalho = sizeof(Cabecalho) + NUM_COLUNAS * sizeof(DescritorColuna);
+
+    DescritorColuna descritores[NUM_COLUNAS];
+    uint64_t deslocamento = alinhar(cabecalho.tamanho_cabecalho);
+    preencherDescritor(descritores[COLUNA_TEMPO_CONCLUSAO], "tempo_conclusao", TIPO_F64, 8, n, deslocamento);
+    preencherDescritor(descritores[COLUNA_DISTANCIA_TOTAL], "distancia_total", TIPO_F64, 8, n, deslocamento);
+    preencherDescritor(descritores[COLUNA_EFICIENCIA], "eficiencia", TIPO_F64, 8, n, deslocamento);
+    preencherDescritor(descritores[COLUNA_NUM_PARADAS], "num_paradas", TIPO_I32, 4, n, deslocamento);
+    preencherDescritor(descritores[COLUNA_INICIO_PARADAS], "inicio_paradas", TIPO_I64, 8, n + 1, deslocamento);
+    preencherDescritor(descritores[COLUNA_COORDENADAS], "coordenadas", TIPO_F64, 8, 2 * total_paradas, deslocamento);
+
+    escreverValor(&cabecalho, sizeof(cabecalho));
+    escreverValor(descritores, sizeof(descritores));
+    completarAlinhamento();
+
+    for (uint64_t i = 0; i < n; i++) {
+        escreverValor(&resultados[i].tempo_conclusao, 8);
+    }
+    for (uint64_t i = 0; i < n; i++) {
+        double distancia = resultados[i].corrida->getDistanciaTotal();
+        escreverValor(&distancia, 8);
+    }
+    for (uint64_t i = 0; i < n; i++) {
+        double eficiencia = resultados[i].corrida->getEficiencia();
+        escreverValor(&eficiencia, 8);
+    }
+    for (uint64_t i = 0; i < n; i++) {
+        int32_t num_paradas = resultados[i].corrida->getNumParadas();
+        escreverValor(&num_paradas, 4);
+    }
+    completarAlinhamento();
+
+    int64_t inicio = 0;
+    for (uint64_t i = 0; i < n; i++) {
+        escreverValor(&inicio, 8);
+        inicio += resultados[i].corrida->getNumParadas();
+    }
+    escreverValor(&inicio, 8);
+
+    for (uint64_t i = 0; i < n; i++) {
+        Parada* paradas = resultados[i].corrida->getParadas();
+        for (int p = 0; p < resultados[i].corrida->getNumParadas(); p++) {
+            double coordenadas[2] = {paradas[p].getCoordX(), paradas[p].getCoordY()};
+            escreverValor(coordenadas, sizeof(coordenadas));
+        }
+    }
+}
+
+// Getters
+uint64_t SaidaBinaria::getBytesGravados() const {
+    return this->bytes_gravados;
+}
+
+// Métodos privados
+void SaidaBinaria::escreverValor(const void* valor, uint64_t largura) {
+    this->escritor.escreverBytes(valor, static_cast<size_t>(largura));
+    this->bytes_gravados += largura;
+}
+
+void SaidaBinaria::completarAlinhamento() {
+    static const char zeros[ALINHAMENTO] = {0};
+    uint64_t folga = alinhar(this->bytes_gravados) - this->bytes_gravados;
+    if (folga > 0) {
+        escreverValor(zeros, folga);
+    }
+}
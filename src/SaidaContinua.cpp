@@ -0,0 +1,91 @@
+#include "SaidaContinua.hpp"
+#include "EscritorSaida.hpp"
+
+static const int CAPACIDADE_INICIAL = 16;
+
+// Construtor
+SaidaContinua::SaidaContinua(EscritorSaida& escritor, Impressora imprimir) : escritor(escritor) {
+    this->imprimir = imprimir;
+    this->capacidade = CAPACIDADE_INICIAL;
+    this->corridas = new Corrida*[this->capacidade];
+    this->ordens = new int[this->capacidade];
+    this->tamanho = 0;
+    this->tempo = 0.0;
+    this->total_escritas = 0;
+    this->maior_buffer = 0;
+    this->fora_de_ordem = 0;
+}
+
+// Destrutor
+SaidaContinua::~SaidaContinua() {
+    delete[] this->corridas;
+    delete[] this->ordens;
+}
+
+// Operações principais
+void SaidaContinua::registrar(double tempo_conclusao, int ordem, Corrida* corrida) {
+    if (this->tamanho > 0 && tempo_conclusao != this->tempo) {
+        if (tempo_conclusao < this->tempo) {
+            this->fora_de_ordem++;
+        }
+        esvaziar();
+    }
+
+    if (this->tamanho == this->capacidade) {
+        int nova_capacidade = this->capacidade * 2;
+        Corrida** novas_corridas = new Corrida*[nova_capacidade];
+        int* novas_ordens = new int[nova_capacidade];
+        for (int i = 0; i < this->tamanho; i++) {
+            novas_corridas[i] = this->corridas[i];
+            novas_ordens[i] = this->ordens[i];
+        }
+        delete[] this->corridas;
+        delete[] this->ordens;
+        this->corridas = novas_corridas;
+        this->ordens = novas_ordens;
+        this->capacidade = nova_capacidade;
+    }
+
+    // Inserção ordenada pela ordem da corrida (o buffer é pequeno)
+    int posicao = this->tamanho;
+    while (posicao > 0 && this->ordens[posicao - 1] > ordem) {
+        this->corridas[posicao] = this->corridas[posicao - 1];
+        this->ordens[posicao] = this->ordens[posicao - 1];
+        posicao--;
+    }
+    this->corridas[posicao] = corrida;
+    this->ordens[posicao] = ordem;
+    this->tamanho++;
+    this->tempo = tempo_conclusao;
+
+    if (this->tamanho > this->maior_buffer) {
+        this->maior_buffer = this->tamanho;
+    }
+}
+
+void SaidaContinua::finalizar() {
+    esvaziar();
+}
+
+// Estatísticas
+long long SaidaContinua::getTotalEscritas() const {
+    return this->total_escritas;
+}
+
+int SaidaContinua::getMaiorBuffer() const {
+    return this->maior_buffer;
+}
+
+long long SaidaContinua::getForaDeOrdem() const {
+    return this->fora_de_ordem;
+}
+
+// Métodos privados
+void SaidaContinua::esvaziar() {
+    for (int i = 0; i < this->tamanho; i++) {
+        this->imprimir(this->escritor, this->corridas[i], this->tempo);
+    }
+    this->total_escritas += this->tamanho;
+    this->tamanho = 0;
+    this->escritor.descarregar();
+}
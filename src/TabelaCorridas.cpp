@@ -0,0 +1,155 @@
+#include "TabelaCorridas.hpp"
+
+// Construtor
+TabelaCorridas::TabelaCorridas(int capacidade_inicial, Escalonador* escalonador) {
+    this->capacidade = capacidade_inicial > 0 ? capacidade_inicial : 1;
+    this->corridas = new Corrida*[this->capacidade];
+    this->geracoes = new unsigned int[this->capacidade];
+    this->eventos_pendentes = new HandleEvento[this->capacidade];
+    this->livres = new int[this->capacidade];
+    this->tamanho = 0;
+    this->num_livres = 0;
+    this->escalonador = escalonador;
+    this->substituicoes = 0;
+    this->eventos_redirecionados = 0;
+    this->partidas_reagendadas = 0;
+    this->eventos_cancelados = 0;
+}
+
+// Destrutor (as corridas pertencem às arenas da execução)
+TabelaCorridas::~TabelaCorridas() {
+    delete[] this->corridas;
+    delete[] this->geracoes;
+    delete[] this->eventos_pendentes;
+    delete[] this->livres;
+}
+
+// Operações principais
+ReferenciaCorrida TabelaCorridas::registrar(Corrida* corrida) {
+    int indice;
+    if (this->num_livres > 0) {
+        indice = this->livres[--this->num_livres];
+    } else {
+        if (this->tamanho == this->capacidade) {
+            redimensionar();
+        }
+        indice = this->tamanho++;
+        this->geracoes[indice] = 0;
+    }
+    this->corridas[indice] = corrida;
+    this->eventos_pendentes[indice].indice = -1;
+    this->eventos_pendentes[indice].geracao = 0;
+    return getReferencia(indice);
+}
+
+// O evento pendente passa a apontar para a nova corrida; se ainda for a
+// partida, vai para o início da nova corrida. Uma corrida já em andamento
+// mantém o horário da próxima parada
+void TabelaCorridas::substituir(int indice, Corrida* nova) {
+    this->corridas[indice] = nova;
+    this->geracoes[indice]++;
+    this->substituicoes++;
+
+    if (this->escalonador == nullptr) {
+        return;
+    }
+    Evento* pendente = this->escalonador->getEvento(this->eventos_pendentes[indice]);
+    if (pendente == nullptr) {
+        return;
+    }
+    pendente->setCorridaAssociada(getReferencia(indice));
+    this->eventos_redirecionados++;
+    if (pendente->getIndiceParada() == 0 && pendente->getTempo() != nova->getTempoInicio()) {
+        this->escalonador->atualizaEvento(this->eventos_pendentes[indice], nova->getTempoInicio());
+        this->partidas_reagendadas++;
+    }
+}
+
+// O índice volta a ser usado por um próximo registro, em nova geração
+void TabelaCorridas::liberar(int indice) {
+    if (this->escalonador != nullptr) {
+        Evento* pendente = this->escalonador->removeEvento(this->eventos_pendentes[indice]);
+        if (pendente != nullptr) {
+            this->escalonador->liberaEvento(pendente);
+            this->eventos_cancelados++;
+        }
+    }
+    this->corridas[indice] = nullptr;
+    this->geracoes[indice]++;
+    this->eventos_pendentes[indice].indice = -1;
+    this->livres[this->num_livres++] = indice;
+}
+
+void TabelaCorridas::vincularEvento(int indice, HandleEvento handle) {
+    this->eventos_pendentes[indice] = handle;
+}
+
+Corrida* TabelaCorridas::obter(ReferenciaCorrida referencia) const {
+    if (referencia.indice < 0 || referencia.indice >= this->tamanho ||
+        this->geracoes[referencia.indice] != referencia.geracao) {
+        return nullptr;
+    }
+    return this->corridas[referencia.indice];
+}
+
+// Getters
+int TabelaCorridas::getTamanho() const {
+    return this->tamanho;
+}
+
+Corrida* TabelaCorridas::getCorrida(int indice) const {
+    return this->corridas[indice];
+}
+
+Corrida* const* TabelaCorridas::getCorridas() const {
+    return this->corridas;
+}
+
+ReferenciaCorrida TabelaCorridas::getReferencia(int indice) const {
+    ReferenciaCorrida referencia;
+    referencia.indice = indice;
+    referencia.geracao = this->geracoes[indice];
+    return referencia;
+}
+
+HandleEvento TabelaCorridas::getEventoPendente(int indice) const {
+    return this->eventos_pendentes[indice];
+}
+
+int TabelaCorridas::getSubstituicoes() const {
+    return this->substituicoes;
+}
+
+int TabelaCorridas::getEventosRedirecionados() const {
+    return this->eventos_redirecionados;
+}
+
+int TabelaCorridas::getPartidasReagendadas() const {
+    return this->partidas_reagendadas;
+}
+
+int TabelaCorridas::getEventosCancelados() const {
+    return this->eventos_cancelados;
+}
+
+// Métodos privados
+void TabelaCorridas::redimensionar() {
+    int nova_capacidade = 2 * this->capacidade;
+    Corrida** novas_corridas = new Corrida*[nova_capacidade];
+    unsigned int* novas_geracoes = new unsigned int[nova_capacidade];
+    HandleEvento* novos_eventos = new HandleEvento[nova_capacidade];
+    for (int i = 0; i < this->tamanho; i++) {
+        novas_corridas[i] = this->corridas[i];
+        novas_geracoes[i] = this->geracoes[i];
+        novos_eventos[i] = this->eventos_pendentes[i];
+    }
+    delete[] this->corridas;
+    delete[] this->geracoes;
+    delete[] this->eventos_pendentes;
+    delete[] this->livres;
+    this->corridas = novas_corridas;
+    this->geracoes = novas_geracoes;
+    this->eventos_pendentes = novos_eventos;
+    this->livres = new int[nova_capacidade];
+    this->capacidade = nova_capacidade;
+}
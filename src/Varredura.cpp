@@ -0,0 +1,745 @@
+#include "Varredura.hpp"
+#include "Agrupamento.hpp"
+#include "ConfiguracoesVarredura.hpp"
+#include "ConstrucaoCorridas.hpp"
+#include "EntradaDemandas.hpp"
+#include "EscritorSaida.hpp"
+#include "InsercaoDinamica.hpp"
+#include "OrdenadorResultados.hpp"
+#include "Relatorios.hpp"
+#include "SimulacaoException.hpp"
+#include "TabelaCorridas.hpp"
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Conjunto de demandas da varredura: lido uma vez e compartilhado, só para
+// leitura, pelas configurações (cada uma agrupa sobre uma cópia própria)
+struct ConjuntoVarredura {
+    DemandaStore* demandas;
+    double cabecalho[NUM_PARAMETROS_VARREDURA];     // Parâmetros do arquivo
+    GrafoCompatibilidade* grafo;    // Pelos maiores delta/alfa/beta das configurações
+};
+
+// Métricas de uma configuração, calculadas como os scripts run_*_tests.sh
+// as extraem da saída: a eficiência entra com as duas casas impressas e as
+// somas seguem a ordem das linhas
+struct MetricasVarredura {
+    int num_corridas;
+    int corridas_individuais;       // Corridas com 2 paradas
+    int corridas_compartilhadas;    // Corridas com mais de 2 paradas
+    double soma_passageiros;        // Paradas / 2 das compartilhadas
+    double soma_eficiencias;
+};
+
+// Lê o arquivo (ou, sem caminho, a entrada padrão) para um conjunto
+static void carregarConjuntoVarredura(const char* caminho, const OpcoesExecucao& opcoes, ConjuntoVarredura& conjunto) {
+    std::string origem = caminho != nullptr ? caminho : "entrada padrao";
+    int descritor = 0;
+    if (caminho != nullptr) {
+        descritor = open(caminho, O_RDONLY);
+        if (descritor < 0) {
+            throw ParametroInvalidoException("Nao foi possivel abrir " + origem);
+        }
+    }
+    
+    LeitorEntrada* leitor = nullptr;
+    if (caminho != nullptr || !opcoes.leitura_stream) {
+        leitor = new LeitorEntrada(descritor);
+    }
+    
+    try {
+        int eta, num_demandas;
+        double gama, delta, alfa, beta, lambda;
+        lerCabecalho(leitor, eta, gama, delta, alfa, beta, lambda, num_demandas);
+        if (num_demandas <= 0) {
+            throw ParametroInvalidoException("Numero de demandas deve ser positivo");
+        }
+        conjunto.cabecalho[PARAMETRO_ETA] = eta;
+        conjunto.cabecalho[PARAMETRO_GAMA] = gama;
+        conjunto.cabecalho[PARAMETRO_DELTA] = delta;
+        conjunto.cabecalho[PARAMETRO_ALFA] = alfa;
+        conjunto.cabecalho[PARAMETRO_BETA] = beta;
+        conjunto.cabecalho[PARAMETRO_LAMBDA] = lambda;
+        
+        conjunto.demandas = new DemandaStore(num_demandas);
+        lerDemandas(leitor, num_demandas, *conjunto.demandas);
+    } catch (const SimulacaoException& e) {
+        delete leitor;
+        if (descritor != 0) {
+            close(descritor);
+        }
+        throw SimulacaoException(origem + ": " + e.what());
+    }
+    
+    delete leitor;
+    if (descritor != 0) {
+        close(descritor);
+    }
+}
+
+// Ordena os resultados como na saída e extrai as métricas, linha a linha
+static MetricasVarredura calcularMetricasVarredura(ResultadoCorrida* resultados, int num_corridas) {
+    OrdenadorResultados ordenador(1);
+    ordenador.ordenar(resultados, num_corridas);
+    
+    MetricasVarredura metricas;
+    metricas.num_corridas = num_corridas;
+    metricas.corridas_individuais = 0;
+    metricas.corridas_compartilhadas = 0;
+    metricas.soma_passageiros = 0.0;
+    metricas.soma_eficiencias = 0.0;
+    char texto[EscritorSaida::TAMANHO_MAXIMO_DECIMAL];
+    for (int k = 0; k < num_corridas; k++) {
+        Corrida* corrida = resultados[k].corrida;
+        int num_paradas = corrida->getNumParadas();
+        if (num_paradas == 2) {
+            metricas.corridas_individuais++;
+        } else if (num_paradas > 2) {
+            metricas.corridas_compartilhadas++;
+            metricas.soma_passageiros += num_paradas / 2.0;
+        }
+        texto[EscritorSaida::formatarDecimal2(corrida->getEficiencia(), texto)] = '\0';
+        metricas.soma_eficiencias += strtod(texto, nullptr);
+    }
+    return metricas;
+}
+
+// Fase 2 sobre os resultados de uma configuração, na ordem da junção
+// (bases[k] é a demanda base da corrida k): a inserção sequencial da
+// execução única, pelo índice de corridas e sem mensagens. As demandas
+// individuais voltam ao estado da junção, então o mesmo store serve a
+// vários cenários. Cada corrida substituída tem a conclusão recalculada a
+// partir do seu início, e a corrida individual de cada demanda inserida
+// sai dos resultados. Retorna o número de corridas restantes
+static int inserirVarredura(DemandaStore& demandas, ResultadoCorrida* resultados, const int* bases, int num_corridas,
+                            const ParametrosFase2& parametros, Arena& arena, Arena& rascunho) {
+    TabelaCorridas corridas(num_corridas, nullptr);
+    IndiceCorridas indice(num_corridas, parametros.desvio_maximo);
+    int* pendentes = new int[num_corridas > 0 ? num_corridas : 1];
+    int num_pendentes = 0;
+    for (int k = 0; k < num_corridas; k++) {
+        corridas.registrar(resultados[k].corrida);
+        registrarCorridaIndice(indice, demandas, resultados[k].corrida, k, parametros.eta);
+        
+        // As bases crescem com k, como as demandas individuais da execução única
+        if (resultados[k].corrida->getNumDemandas() == 1) {
+            demandas.setEstado(bases[k], INDIVIDUAL);
+            demandas.setIndiceCorrida(bases[k], k);
+            pendentes[num_pendentes++] = bases[k];
+        }
+    }
+    
+    inserirSequencial(demandas, corridas, num_corridas, &indice, pendentes, num_pendentes, parametros, arena,
+                      rascunho);
+    
+    int restantes = 0;
+    for (int k = 0; k < num_corridas; k++) {
+        Corrida* corrida = corridas.getCorrida(k);
+        if (corrida != nullptr) {
+            resultados[restantes].corrida = corrida;
+            resultados[restantes].tempo_conclusao = calcularConclusaoDireta(corrida, corrida->getTempoInicio());
+            restantes++;
+        }
+    }
+    
+    delete[] pendentes;
+    return restantes;
+}
+
+// Parâmetros da fase 2 de uma configuração
+static ParametrosFase2 parametrosInsercaoVarredura(const double* valores) {
+    ParametrosFase2 parametros;
+    parametros.eta = static_cast<int>(valores[PARAMETRO_ETA]);
+    parametros.gama = valores[PARAMETRO_GAMA];
+    parametros.lambda = valores[PARAMETRO_LAMBDA];
+    parametros.desvio_maximo = DESVIO_MAXIMO_ABSOLUTO;
+    parametros.reportar_insercoes = false;
+    return parametros;
+}
+
+// Cópia do conjunto que as fases 1 e 2 de uma configuração podem alterar
+static void copiarDemandas(const DemandaStore& original, DemandaStore& copia) {
+    for (int i = 0; i < original.getTamanho(); i++) {
+        copia.adicionar(original.getId(i), original.getTempoSolicitacao(i), original.getOrigemX(i),
+                        original.getOrigemY(i), original.getDestinoX(i), original.getDestinoY(i));
+    }
+}
+
+// Fases 1 e 2 e avanço direto de uma configuração sobre uma cópia do
+// conjunto
+static MetricasVarredura executarConfiguracaoVarredura(const ConjuntoVarredura& conjunto, const double* valores,
+                                                       const OpcoesExecucao& opcoes) {
+    const DemandaStore& original = *conjunto.demandas;
+    int num_demandas = original.getTamanho();
+    DemandaStore demandas(num_demandas);
+    copiarDemandas(original, demandas);
+    
+    ParametrosFase1 parametros;
+    parametros.eta = static_cast<int>(valores[PARAMETRO_ETA]);
+    parametros.gama = valores[PARAMETRO_GAMA];
+    parametros.delta = valores[PARAMETRO_DELTA];
+    parametros.alfa = valores[PARAMETRO_ALFA];
+    parametros.beta = valores[PARAMETRO_BETA];
+    parametros.lambda = valores[PARAMETRO_LAMBDA];
+    parametros.avaliacao_reconstrucao = opcoes.avaliacao_reconstrucao;
+    
+    // Com o grafo do conjunto, a configuração só filtra as arestas
+    GradeEspacial* grade = nullptr;
+    parametros.grade = nullptr;
+    parametros.grafo = nullptr;
+    if (conjunto.grafo != nullptr && conjunto.grafo->cobre(parametros.delta, parametros.alfa, parametros.beta)) {
+        parametros.grafo = conjunto.grafo;
+    } else if (!opcoes.indice_linear) {
+        grade = new GradeEspacial(&demandas, parametros.delta, parametros.alfa, parametros.beta);
+        parametros.grade = grade->estaHabilitada() ? grade : nullptr;
+    }
+    
+    Arena arena;
+    Arena rascunho;
+    TrabalhadorFase1 trabalhador(&demandas, parametros, opcoes.isa, &arena, &rascunho);
+    
+    Corrida** corridas_por_base = new Corrida*[num_demandas];
+    for (int i = 0; i < num_demandas; i++) {
+        corridas_por_base[i] = nullptr;
+    }
+    agruparLote(demandas, parametros, trabalhador, 0, num_demandas, corridas_por_base);
+    delete grade;
+    
+    // Resultados na ordem da junção, ordenados como na saída
+    const double* tempos = demandas.getTempos();
+    ResultadoCorrida* resultados = new ResultadoCorrida[num_demandas];
+    int* bases = new int[num_demandas];
+    int num_corridas = 0;
+    for (int i = 0; i < num_demandas; i++) {
+        if (corridas_por_base[i] != nullptr) {
+            resultados[num_corridas].tempo_conclusao = calcularConclusaoDireta(corridas_por_base[i], tempos[i]);
+            resultados[num_corridas].corrida = corridas_por_base[i];
+            bases[num_corridas] = i;
+            num_corridas++;
+        }
+    }
+    delete[] corridas_por_base;
+    
+    num_corridas = inserirVarredura(demandas, resultados, bases, num_corridas, parametrosInsercaoVarredura(valores),
+                                    arena, rascunho);
+    MetricasVarredura metricas = calcularMetricasVarredura(resultados, num_corridas);
+    delete[] bases;
+    delete[] resultados;
+    
+    return metricas;
+}
+
+// Cenários avaliados juntos: um bit de uint64_t por valor de lambda
+static const int MAXIMO_CENARIOS = 64;
+
+// Limite de resultados guardados por um pacote (cenários x demandas)
+static const long long LIMITE_RESULTADOS_CENARIOS = 1LL << 24;
+
+// Grupo em formação compartilhado pelos cenários da máscara
+struct ClasseCenarios {
+    uint64_t cenarios;
+    AvaliadorCorrida* avaliador;
+};
+
+// Avalia numa só passada configurações que diferem apenas em lambda
+// (lambdas em ordem crescente). Lambda só decide onde um grupo para de
+// crescer: numa mesma base, cenários com a mesma história formam o mesmo
+// grupo, então cada classe de cenários testa cada candidata uma única vez
+// (distâncias, compatibilidade e eficiência). disponiveis[j] guarda, um bit
+// por cenário, onde a demanda j ainda não foi agrupada. Com os lambdas
+// ordenados, os cenários que aceitam uma eficiência formam um prefixo de
+// bits, e a classe se divide em no máximo três: os que não têm a
+// candidata disponível, os que param e os que a adicionam
+static void executarCenariosVarredura(const ConjuntoVarredura& conjunto, const double* valores, const double* lambdas,
+                                      int num_cenarios, const OpcoesExecucao& opcoes, MetricasVarredura* metricas) {
+    const DemandaStore& demandas = *conjunto.demandas;
+    int num_demandas = demandas.getTamanho();
+    const double* tempos = demandas.getTempos();
+    int eta = static_cast<int>(valores[PARAMETRO_ETA]);
+    double gama = valores[PARAMETRO_GAMA];
+    double delta = valores[PARAMETRO_DELTA];
+    double alfa = valores[PARAMETRO_ALFA];
+    double beta = valores[PARAMETRO_BETA];
+    
+    // Mesma fonte de candidatas de uma configuração isolada
+    const GrafoCompatibilidade* grafo = nullptr;
+    GradeEspacial* grade = nullptr;
+    if (conjunto.grafo != nullptr && conjunto.grafo->cobre(delta, alfa, beta)) {
+        grafo = conjunto.grafo;
+    } else if (!opcoes.indice_linear) {
+        grade = new GradeEspacial(&demandas, delta, alfa, beta);
+        if (!grade->estaHabilitada()) {
+            delete grade;
+            grade = nullptr;
+        }
+    }
+    const int* vizinhos = grafo != nullptr ? grafo->getVizinhos() : nullptr;
+    const double* distancias_origem = grafo != nullptr ? grafo->getDistanciasOrigem() : nullptr;
+    const double* distancias_destino = grafo != nullptr ? grafo->getDistanciasDestino() : nullptr;
+    const double* rotas = grafo != nullptr ? grafo->getRotas() : nullptr;
+    
+    Arena arena;
+    Arena rascunho;
+    VerificadorCompatibilidade verificador(&demandas, alfa, beta, opcoes.isa);
+    AvaliadorCorrida** avaliadores = new AvaliadorCorrida*[num_cenarios];
+    for (int k = 0; k < num_cenarios; k++) {
+        avaliadores[k] = new AvaliadorCorrida(&demandas, eta);
+    }
+    ClasseCenarios* classes = new ClasseCenarios[num_cenarios];
+    int* candidatas = new int[num_demandas];
+    
+    uint64_t todos = num_cenarios == MAXIMO_CENARIOS ? ~0ULL : (1ULL << num_cenarios) - 1;
+    uint64_t* disponiveis = new uint64_t[num_demandas];
+    for (int j = 0; j < num_demandas; j++) {
+        disponiveis[j] = todos;
+    }
+    
+    // Resultados do cenário k em [k * num_demandas, ...), na ordem das bases
+    ResultadoCorrida* resultados = new ResultadoCorrida[static_cast<size_t>(num_cenarios) * num_demandas];
+    int* bases = new int[static_cast<size_t>(num_cenarios) * num_demandas];
+    int* num_resultados = new int[num_cenarios];
+    for (int k = 0; k < num_cenarios; k++) {
+        num_resultados[k] = 0;
+    }
+    
+    // Materializa o grupo da classe para os cenários indicados, que deixam a classe
+    auto finalizar = [&](ClasseCenarios& classe, uint64_t cenarios, int base) {
+        const int* membros = classe.avaliador->getMembros();
+        int num_membros = classe.avaliador->getNumMembros();
+        Corrida* corrida = construirCorrida(demandas, membros, num_membros, gama, tempos[base], arena);
+        corrida->setEficiencia(calcularEficienciaCorrida(demandas, membros, num_membros, corrida->getDistanciaTotal()));
+        double conclusao = calcularConclusaoDireta(corrida, tempos[base]);
+        
+        for (int m = 0; m < num_membros; m++) {
+            disponiveis[membros[m]] &= ~cenarios;
+        }
+        for (int k = 0; k < num_cenarios; k++) {
+            if ((cenarios >> k) & 1) {
+                size_t posicao = static_cast<size_t>(k) * num_demandas + num_resultados[k]++;
+                resultados[posicao].tempo_conclusao = conclusao;
+                resultados[posicao].corrida = corrida;
+                bases[posicao] = base;
+            }
+        }
+        classe.cenarios &= ~cenarios;
+    };
+    
+    for (int i = 0; i < num_demandas; i++) {
+        if (disponiveis[i] == 0) {
+            continue;
+        }
+        
+        int num_classes = 1;
+        classes[0].cenarios = disponiveis[i];
+        classes[0].avaliador = avaliadores[0];
+        classes[0].avaliador->iniciar(i);
+        if (eta <= 1) {
+            finalizar(classes[0], classes[0].cenarios, i);
+            continue;
+        }
+        
+        // Pelo grafo, uma lista sem arestas dentro de alfa/beta é pulada inteira
+        int num_candidatas = grafo != nullptr ? (grafo->temCandidatas(i, alfa, beta)
+                                                 ? static_cast<int>(grafo->getFim(i) - grafo->getInicio(i)) : 0)
+                           : grade != nullptr ? grade->buscarCandidatas(i, candidatas)
+                           : num_demandas - i - 1;
+        uint64_t ativos = classes[0].cenarios;
+        
+        for (int c = 0; c < num_candidatas && ativos != 0; c++) {
+            long long aresta = grafo != nullptr ? grafo->getInicio(i) + c : -1;
+            int j = grafo != nullptr ? vizinhos[aresta] : grade != nullptr ? candidatas[c] : i + 1 + c;
+            
+            // Classes criadas nesta candidata já a contêm
+            int classes_existentes = num_classes;
+            for (int k = 0; k < classes_existentes; k++) {
+                ClasseCenarios& classe = classes[k];
+                uint64_t candidatos = classe.cenarios & disponiveis[j];
+                if (candidatos == 0) {
+                    continue;
+                }
+                AvaliadorCorrida& avaliador = *classe.avaliador;
+                
+                // Critério 1: Intervalo de tempo
+                if (tempos[j] - tempos[i] >= delta) {
+                    finalizar(classe, candidatos, i);
+                    continue;
+                }
+                
+                // Critério 2 e 3: pelo grafo ou pelo verificador
+                const int* membros = avaliador.getMembros();
+                long long aresta_ultimo = aresta;
+                bool compativel;
+                if (grafo != nullptr) {
+                    compativel = !(distancias_origem[aresta] > alfa) && !(distancias_destino[aresta] > beta);
+                    for (int m = 1; m < avaliador.getNumMembros() && compativel; m++) {
+                        aresta_ultimo = grafo->buscarAresta(membros[m], j);
+                        compativel = aresta_ultimo >= 0 && !(distancias_origem[aresta_ultimo] > alfa) &&
+                                     !(distancias_destino[aresta_ultimo] > beta);
+                    }
+                } else {
+                    compativel = verificador.verificarGrupo(membros, avaliador.getNumMembros(), j);
+                }
+                if (!compativel) {
+                    continue;
+                }
+                
+                double eficiencia;
+                if (opcoes.avaliacao_reconstrucao) {
+                    eficiencia = avaliarPorReconstrucao(demandas, membros, avaliador.getNumMembros(), j, gama,
+                                                        tempos[i], rascunho);
+                } else {
+                    if (grafo != nullptr) {
+                        avaliador.informarCandidato(j, distancias_origem[aresta_ultimo],
+                                                    distancias_destino[aresta_ultimo], rotas[aresta]);
+                    }
+                    eficiencia = avaliador.calcularEficienciaComAdicao(j);
+                }
+                
+                // Critério 4: aceitam os cenários com lambda <= eficiência
+                int aceitos = 0;
+                while (aceitos < num_cenarios && !(eficiencia < lambdas[aceitos])) {
+                    aceitos++;
+                }
+                uint64_t prefixo = aceitos == MAXIMO_CENARIOS ? ~0ULL : (1ULL << aceitos) - 1;
+                uint64_t aceitam = candidatos & prefixo;
+                if (candidatos & ~prefixo) {
+                    finalizar(classe, candidatos & ~prefixo, i);
+                }
+                if (aceitam == 0) {
+                    continue;
+                }
+                
+                ClasseCenarios* destino = &classe;
+                if (aceitam != classe.cenarios) {
+                    destino = &classes[num_classes];
+                    destino->cenarios = aceitam;
+                    destino->avaliador = avaliadores[num_classes];
+                    destino->avaliador->copiarDe(avaliador);
+                    classe.cenarios &= ~aceitam;
+                    num_classes++;
+                }
+                destino->avaliador->adicionar(j);
+                if (destino->avaliador->getNumMembros() >= eta) {
+                    finalizar(*destino, destino->cenarios, i);
+                }
+            }
+            
+            ativos = 0;
+            for (int k = 0; k < num_classes; k++) {
+                ativos |= classes[k].cenarios;
+            }
+        }
+        
+        for (int k = 0; k < num_classes; k++) {
+            if (classes[k].cenarios != 0) {
+                finalizar(classes[k], classes[k].cenarios, i);
+            }
+        }
+    }
+    
+    // A fase 2 depende das corridas de cada cenário: uma por vez, sobre uma
+    // cópia das demandas (a fase 1 dos cenários não as altera)
+    DemandaStore demandas_insercao(num_demandas);
+    copiarDemandas(demandas, demandas_insercao);
+    for (int k = 0; k < num_cenarios; k++) {
+        double valores_cenario[NUM_PARAMETROS_VARREDURA];
+        for (int p = 0; p < NUM_PARAMETROS_VARREDURA; p++) {
+            valores_cenario[p] = valores[p];
+        }
+        valores_cenario[PARAMETRO_LAMBDA] = lambdas[k];
+        
+        size_t inicio = static_cast<size_t>(k) * num_demandas;
+        num_resultados[k] = inserirVarredura(demandas_insercao, resultados + inicio, bases + inicio,
+                                             num_resultados[k], parametrosInsercaoVarredura(valores_cenario),
+                                             arena, rascunho);
+        metricas[k] = calcularMetricasVarredura(resultados + inicio, num_resultados[k]);
+    }
+    
+    delete[] num_resultados;
+    delete[] bases;
+    delete[] resultados;
+    delete[] disponiveis;
+    delete[] candidatas;
+    delete[] classes;
+    for (int k = 0; k < num_cenarios; k++) {
+        delete avaliadores[k];
+    }
+    delete[] avaliadores;
+    delete grade;
+}
+
+static void liberarConjuntosVarredura(ConjuntoVarredura* conjuntos, int num_conjuntos) {
+    for (int c = 0; c < num_conjuntos; c++) {
+        delete conjuntos[c].grafo;
+        delete conjuntos[c].demandas;
+    }
+    delete[] conjuntos;
+}
+
+// Ordem por conjunto e parâmetros, com lambda por último (ou ignorado):
+// configurações vizinhas que só diferem em lambda formam um pacote
+static int compararConfiguracoesVarredura(const ConfiguracaoVarredura& a, const ConfiguracaoVarredura& b,
+                                          bool inclui_lambda) {
+    if (a.conjunto != b.conjunto) {
+        return a.conjunto < b.conjunto ? -1 : 1;
+    }
+    int parametros = inclui_lambda ? NUM_PARAMETROS_VARREDURA : PARAMETRO_LAMBDA;
+    for (int p = 0; p < parametros; p++) {
+        if (a.valores[p] != b.valores[p]) {
+            return a.valores[p] < b.valores[p] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+// Merge sort estável dos índices das configurações
+static void ordenarConfiguracoesVarredura(ConfiguracoesVarredura& configuracoes, int* ordem, int quantidade) {
+    int* auxiliar = new int[quantidade > 0 ? quantidade : 1];
+    for (int largura = 1; largura < quantidade; largura *= 2) {
+        for (int inicio = 0; inicio < quantidade; inicio += 2 * largura) {
+            int meio = inicio + largura < quantidade ? inicio + largura : quantidade;
+            int fim = inicio + 2 * largura < quantidade ? inicio + 2 * largura : quantidade;
+            int a = inicio;
+            int b = meio;
+            for (int k = inicio; k < fim; k++) {
+                if (a < meio && (b >= fim || compararConfiguracoesVarredura(configuracoes.getConfiguracao(ordem[b]),
+                                                                            configuracoes.getConfiguracao(ordem[a]),
+                                                                            true) >= 0)) {
+                    auxiliar[k] = ordem[a++];
+                } else {
+                    auxiliar[k] = ordem[b++];
+                }
+            }
+        }
+        for (int k = 0; k < quantidade; k++) {
+            ordem[k] = auxiliar[k];
+        }
+    }
+    delete[] auxiliar;
+}
+
+// Executa todas as configurações do arquivo num conjunto de threads e
+// escreve uma linha CSV de métricas por configuração, na ordem do arquivo
+void executarVarredura(const char* caminho_configuracoes, const OpcoesExecucao& opcoes) {
+    std::chrono::steady_clock::time_point inicio = std::chrono::steady_clock::now();
+    
+    ConfiguracoesVarredura configuracoes;
+    if (!configuracoes.carregar(caminho_configuracoes)) {
+        throw ParametroInvalidoException(std::string("Varredura: ") + configuracoes.getErro());
+    }
+    int num_configuracoes = configuracoes.getNumConfiguracoes();
+    int num_conjuntos = configuracoes.getNumConjuntos();
+    
+    // Cada arquivo de demandas é lido uma única vez
+    ConjuntoVarredura* conjuntos = new ConjuntoVarredura[num_conjuntos];
+    for (int c = 0; c < num_conjuntos; c++) {
+        conjuntos[c].demandas = nullptr;
+        conjuntos[c].grafo = nullptr;
+    }
+    try {
+        for (int c = 0; c < num_conjuntos; c++) {
+            carregarConjuntoVarredura(configuracoes.getCaminhoConjunto(c), opcoes, conjuntos[c]);
+        }
+    } catch (...) {
+        liberarConjuntosVarredura(conjuntos, num_conjuntos);
+        throw;
+    }
+    
+    if (opcoes.exibir_tempos) {
+        std::cerr << "Varredura: " << num_configuracoes << " configuracao(oes), " << num_conjuntos
+                  << " conjunto(s) lido(s) em " << segundosDesde(inicio) << " s" << std::endl;
+    }
+    
+    // Valores herdados vêm do cabeçalho do conjunto; todas as configurações
+    // são validadas antes de qualquer execução
+    for (int k = 0; k < num_configuracoes; k++) {
+        ConfiguracaoVarredura& configuracao = configuracoes.getConfiguracao(k);
+        for (int p = 0; p < NUM_PARAMETROS_VARREDURA; p++) {
+            if (configuracao.herdados & (1 << p)) {
+                configuracao.valores[p] = conjuntos[configuracao.conjunto].cabecalho[p];
+            }
+        }
+        
+        const double* valores = configuracao.valores;
+        try {
+            if (valores[PARAMETRO_ETA] != floor(valores[PARAMETRO_ETA]) || valores[PARAMETRO_ETA] > 1e9) {
+                throw ParametroInvalidoException("Capacidade do veiculo (eta) deve ser inteira");
+            }
+            validarParametros(static_cast<int>(valores[PARAMETRO_ETA]), valores[PARAMETRO_GAMA],
+                              valores[PARAMETRO_DELTA], valores[PARAMETRO_ALFA], valores[PARAMETRO_BETA],
+                              valores[PARAMETRO_LAMBDA]);
+        } catch (const SimulacaoException& e) {
+            liberarConjuntosVarredura(conjuntos, num_conjuntos);
+            throw ParametroInvalidoException("Configuracao " + std::to_string(k + 1) + ": " + e.what());
+        }
+    }
+    
+    // Um grafo por conjunto, com os maiores limites das suas configurações:
+    // as distâncias de cada par são calculadas uma só vez na varredura
+    if (opcoes.compatibilidade != COMPATIBILIDADE_DIRETA) {
+        std::chrono::steady_clock::time_point inicio_grafos = std::chrono::steady_clock::now();
+        for (int c = 0; c < num_conjuntos; c++) {
+            double maiores[NUM_PARAMETROS_VARREDURA] = {0.0};
+            for (int k = 0; k < num_configuracoes; k++) {
+                const ConfiguracaoVarredura& configuracao = configuracoes.getConfiguracao(k);
+                for (int p = 0; configuracao.conjunto == c && p < NUM_PARAMETROS_VARREDURA; p++) {
+                    if (configuracao.valores[p] > maiores[p]) {
+                        maiores[p] = configuracao.valores[p];
+                    }
+                }
+            }
+            conjuntos[c].grafo = new GrafoCompatibilidade(conjuntos[c].demandas, maiores[PARAMETRO_DELTA],
+                                                          maiores[PARAMETRO_ALFA], maiores[PARAMETRO_BETA]);
+            if (!conjuntos[c].grafo->estaHabilitado()) {
+                avisarGrafoDesabilitado(*conjuntos[c].grafo);
+            } else if (opcoes.exibir_tempos) {
+                imprimirEstatisticasGrafo(*conjuntos[c].grafo, segundosDesde(inicio_grafos));
+            }
+        }
+    }
+    
+    // Pacotes de configurações que só diferem em lambda, com os lambdas em
+    // ordem crescente (individualmente, um pacote por configuração)
+    int* ordem = new int[num_configuracoes];
+    for (int k = 0; k < num_configuracoes; k++) {
+        ordem[k] = k;
+    }
+    int* inicio_pacotes = new int[num_configuracoes + 1];
+    int num_pacotes = 0;
+    if (opcoes.cenarios_individuais) {
+        for (int k = 0; k <= num_configuracoes; k++) {
+            inicio_pacotes[k] = k;
+        }
+        num_pacotes = num_configuracoes;
+    } else {
+        ordenarConfiguracoesVarredura(configuracoes, ordem, num_configuracoes);
+        for (int k = 0; k < num_configuracoes; k++) {
+            const ConfiguracaoVarredura& configuracao = configuracoes.getConfiguracao(ordem[k]);
+            long long tamanho = conjuntos[configuracao.conjunto].demandas->getTamanho();
+            long long maximo = LIMITE_RESULTADOS_CENARIOS / tamanho;
+            if (maximo > MAXIMO_CENARIOS) {
+                maximo = MAXIMO_CENARIOS;
+            }
+            if (k == 0 || k - inicio_pacotes[num_pacotes - 1] >= maximo ||
+                compararConfiguracoesVarredura(configuracoes.getConfiguracao(ordem[k - 1]), configuracao, false) != 0) {
+                inicio_pacotes[num_pacotes++] = k;
+            }
+        }
+        inicio_pacotes[num_pacotes] = num_configuracoes;
+    }
+    
+    // Um pacote por vez em cada thread
+    MetricasVarredura* metricas = new MetricasVarredura[num_configuracoes];
+    int num_trabalhadores = opcoes.threads < num_pacotes ? opcoes.threads : num_pacotes;
+    std::atomic<int> proximo_pacote(0);
+    std::exception_ptr* erros = new std::exception_ptr[num_trabalhadores];
+    auto executarTrabalhador = [&](int t) {
+        try {
+            double lambdas[MAXIMO_CENARIOS];
+            MetricasVarredura metricas_pacote[MAXIMO_CENARIOS];
+            for (int pacote = proximo_pacote++; pacote < num_pacotes; pacote = proximo_pacote++) {
+                int inicio = inicio_pacotes[pacote];
+                int num_cenarios = inicio_pacotes[pacote + 1] - inicio;
+                const ConfiguracaoVarredura& primeira = configuracoes.getConfiguracao(ordem[inicio]);
+                if (num_cenarios == 1) {
+                    metricas[ordem[inicio]] = executarConfiguracaoVarredura(conjuntos[primeira.conjunto],
+                                                                            primeira.valores, opcoes);
+                    continue;
+                }
+                
+                for (int k = 0; k < num_cenarios; k++) {
+                    lambdas[k] = configuracoes.getConfiguracao(ordem[inicio + k]).valores[PARAMETRO_LAMBDA];
+                }
+                executarCenariosVarredura(conjuntos[primeira.conjunto], primeira.valores, lambdas, num_cenarios,
+                                          opcoes, metricas_pacote);
+                for (int k = 0; k < num_cenarios; k++) {
+                    metricas[ordem[inicio + k]] = metricas_pacote[k];
+                }
+            }
+        } catch (...) {
+            erros[t] = std::current_exception();
+        }
+    };
+    
+    std::thread* threads = new std::thread[num_trabalhadores - 1];
+    for (int t = 1; t < num_trabalhadores; t++) {
+        threads[t - 1] = std::thread(executarTrabalhador, t);
+    }
+    executarTrabalhador(0);
+    for (int t = 1; t < num_trabalhadores; t++) {
+        threads[t - 1].join();
+    }
+    delete[] threads;
+    
+    std::exception_ptr erro = nullptr;
+    for (int t = 0; t < num_trabalhadores && !erro; t++) {
+        erro = erros[t];
+    }
+    delete[] erros;
+    delete[] ordem;
+    delete[] inicio_pacotes;
+    if (erro) {
+        liberarConjuntosVarredura(conjuntos, num_conjuntos);
+        delete[] metricas;
+        std::rethrow_exception(erro);
+    }
+    
+    // Mesmas colunas e formatos (printf do awk) dos scripts
+    EscritorSaida escritor(std::cout);
+    escritor.escreverTexto("test_num,eta,gamma,delta,alpha,beta,lambda,total_demands,individual_rides,"
+                           "shared_rides,pct_shared,avg_passengers_shared,avg_efficiency\n");
+    char linha[1024];
+    for (int k = 0; k < num_configuracoes; k++) {
+        const ConfiguracaoVarredura& configuracao = configuracoes.getConfiguracao(k);
+        const double* valores = configuracao.valores;
+        const MetricasVarredura& m = metricas[k];
+        int total_corridas = m.corridas_individuais + m.corridas_compartilhadas;
+        
+        int tamanho = snprintf(linha, sizeof(linha), "%d,%d,%.10g,%.10g,%.10g,%.10g,%.10g,%d,%d,%d,", k + 1,
+                               static_cast<int>(valores[PARAMETRO_ETA]), valores[PARAMETRO_GAMA],
+                               valores[PARAMETRO_DELTA], valores[PARAMETRO_ALFA], valores[PARAMETRO_BETA],
+                               valores[PARAMETRO_LAMBDA], conjuntos[configuracao.conjunto].demandas->getTamanho(),
+                               m.corridas_individuais, m.corridas_compartilhadas);
+        escritor.escreverBytes(linha, tamanho);
+        
+        if (total_corridas > 0) {
+            tamanho = snprintf(linha, sizeof(linha), "%.2f,", 100.0 * m.corridas_compartilhadas / total_corridas);
+        } else {
+            tamanho = snprintf(linha, sizeof(linha), "0.00,");
+        }
+        escritor.escreverBytes(linha, tamanho);
+        
+        if (m.corridas_compartilhadas > 0) {
+            tamanho = snprintf(linha, sizeof(linha), "%.2f,", m.soma_passageiros / m.corridas_compartilhadas);
+        } else {
+            tamanho = snprintf(linha, sizeof(linha), "0.00,");
+        }
+        escritor.escreverBytes(linha, tamanho);
+        
+        if (m.num_corridas > 0) {
+            tamanho = snprintf(linha, sizeof(linha), "%.4f\n", m.soma_eficiencias / m.num_corridas);
+        } else {
+            tamanho = snprintf(linha, sizeof(linha), "0.0000\n");
+        }
+        escritor.escreverBytes(linha, tamanho);
+    }
+    escritor.descarregar();
+    
+    if (opcoes.exibir_tempos) {
+        std::cerr << "Varredura: " << num_trabalhadores << " thread(s), " << num_configuracoes
+                  << " configuracao(oes) em " << num_pacotes << " pacote(s), " << segundosDesde(inicio) << " s" << std::endl;
+    }
+    
+    liberarConjuntosVarredura(conjuntos, num_conjuntos);
+    delete[] metricas;
+}
@@ -0,0 +1,215 @@
+#include "VerificadorCompatibilidade.hpp"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define VERIFICADOR_X86 1
+#include <immintrin.h>
+#endif
+
+static uint64_t mascaraCompleta(int quantidade) {
+    return quantidade >= 64 ? ~0ULL : ((1ULL << quantidade) - 1);
+}
+
+// Núcleos: bit k ligado se !(dx * dx + dy * dy > limite). A negação mantém
+// NaN como compatível, tal como !(sqrt(NaN) > alfa) no caminho escalar
+
+static uint64_t nucleoEscalar(const double* xs, const double* ys, int quantidade,
+                              double px, double py, double limite) {
+    uint64_t mascara = 0;
+    for (int k = 0; k < quantidade; k++) {
+        double dx = xs[k] - px;
+        double dy = ys[k] - py;
+        if (!(dx * dx + dy * dy > limite)) {
+            mascara |= 1ULL << k;
+        }
+    }
+    return mascara;
+}
+
+#ifdef VERIFICADOR_X86
+
+__attribute__((target("sse2")))
+static uint64_t nucleoSse2(const double* xs, const double* ys, int quantidade,
+                           double px, double py, double limite) {
+    __m128d vpx = _mm_set1_pd(px);
+    __m128d vpy = _mm_set1_pd(py);
+    __m128d vlimite = _mm_set1_pd(limite);
+    uint64_t mascara = 0;
+    int k = 0;
+    for (; k + 2 <= quantidade; k += 2) {
+        __m128d dx = _mm_sub_pd(_mm_loadu_pd(xs + k), vpx);
+        __m128d dy = _mm_sub_pd(_mm_loadu_pd(ys + k), vpy);
+        __m128d soma = _mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy));
+        int bits = _mm_movemask_pd(_mm_cmpngt_pd(soma, vlimite));
+        mascara |= static_cast<uint64_t>(bits) << k;
+    }
+    if (k < quantidade) {
+        mascara |= nucleoEscalar(xs + k, ys + k, quantidade - k, px, py, limite) << k;
+    }
+    return mascara;
+}
+
+__attribute__((target("avx2")))
+static uint64_t nucleoAvx2(const double* xs, const double* ys, int quantidade,
+                           double px, double py, double limite) {
+    __m256d vpx = _mm256_set1_pd(px);
+    __m256d vpy = _mm256_set1_pd(py);
+    __m256d vlimite = _mm256_set1_pd(limite);
+    uint64_t mascara = 0;
+    int k = 0;
+    for (; k + 4 <= quantidade; k += 4) {
+        __m256d dx = _mm256_sub_pd(_mm256_loadu_pd(xs + k), vpx);
+        __m256d dy = _mm256_sub_pd(_mm256_loadu_pd(ys + k), vpy);
+        // Sem FMA: multiplicações e soma arredondadas como no caminho escalar
+        __m256d soma = _mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy));
+        int bits = _mm256_movemask_pd(_mm256_cmp_pd(soma, vlimite, _CMP_NGT_UQ));
+        mascara |= static_cast<uint64_t>(bits) << k;
+    }
+    if (k < quantidade) {
+        mascara |= nucleoSse2(xs + k, ys + k, quantidade - k, px, py, limite) << k;
+    }
+    return mascara;
+}
+
+#endif
+
+// Construtor
+VerificadorCompatibilidade::VerificadorCompatibilidade(const DemandaStore* demandas, double alfa, double beta,
+                                                       ConjuntoInstrucoes isa) {
+    this->demandas = demandas;
+    this->limite_origem = calcularLimiteQuadrado(alfa);
+    this->limite_destino = calcularLimiteQuadrado(beta);
+    ConjuntoInstrucoes disponivel = detectarConjuntoInstrucoes();
+    this->isa = (isa == ISA_AUTOMATICO || isa > disponivel) ? disponivel : isa;
+    this->nucleo = obterNucleo(this->isa);
+}
+
+// Operações principais
+bool VerificadorCompatibilidade::verificarGrupo(const int* membros, int num_membros, int nova) {
+    for (int inicio = 0; inicio < num_membros; inicio += TAMANHO_LOTE) {
+        int quantidade = num_membros - inicio;
+        if (quantidade > TAMANHO_LOTE) {
+            quantidade = TAMANHO_LOTE;
+        }
+        uint64_t completa = mascaraCompleta(quantidade);
+        if (compararMembros(this->demandas->getOrigensX(), this->demandas->getOrigensY(),
+                            membros + inicio, quantidade, nova, this->limite_origem) != completa) {
+            return false;
+        }
+        if (compararMembros(this->demandas->getDestinosX(), this->demandas->getDestinosY(),
+                            membros + inicio, quantidade, nova, this->limite_destino) != completa) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint64_t VerificadorCompatibilidade::compararBloco(int base, int inicio, int quantidade) const {
+    if (quantidade > TAMANHO_LOTE) {
+        quantidade = TAMANHO_LOTE;
+    }
+    if (quantidade <= 0) {
+        return 0;
+    }
+    const double* origens_x = this->demandas->getOrigensX();
+    const double* origens_y = this->demandas->getOrigensY();
+    const double* destinos_x = this->demandas->getDestinosX();
+    const double* destinos_y = this->demandas->getDestinosY();
+
+    // As colunas já são contíguas: o bloco é lido direto do store
+    uint64_t mascara = this->nucleo(origens_x + inicio, origens_y + inicio, quantidade,
+                                    origens_x[base], origens_y[base], this->limite_origem);
+    if (mascara == 0) {
+        return 0;
+    }
+    return mascara & this->nucleo(destinos_x + inicio, destinos_y + inicio, quantidade,
+                                  destinos_x[base], destinos_y[base], this->limite_destino);
+}
+
+// Getters
+ConjuntoInstrucoes VerificadorCompatibilidade::getConjuntoInstrucoes() const {
+    return this->isa;
+}
+
+const char* VerificadorCompatibilidade::nomeConjuntoInstrucoes(ConjuntoInstrucoes isa) {
+    switch (isa) {
+        case ISA_AUTOMATICO: return "automatico";
+        case ISA_ESCALAR: return "escalar";
+        case ISA_SSE2: return "sse2";
+        case ISA_AVX2: return "avx2";
+    }
+    return "desconhecido";
+}
+
+// Núcleos disponíveis
+ConjuntoInstrucoes VerificadorCompatibilidade::detectarConjuntoInstrucoes() {
+#ifdef VERIFICADOR_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return ISA_AVX2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return ISA_SSE2;
+    }
+#endif
+    return ISA_ESCALAR;
+}
+
+// Conjuntos não suportados pelo processador (ou pela arquitetura) caem no
+// mais largo disponível abaixo deles
+VerificadorCompatibilidade::Nucleo VerificadorCompatibilidade::obterNucleo(ConjuntoInstrucoes isa) {
+    ConjuntoInstrucoes disponivel = detectarConjuntoInstrucoes();
+    if (isa == ISA_AUTOMATICO || isa > disponivel) {
+        isa = disponivel;
+    }
+#ifdef VERIFICADOR_X86
+    if (isa == ISA_AVX2) {
+        return nucleoAvx2;
+    }
+    if (isa == ISA_SSE2) {
+        return nucleoSse2;
+    }
+#endif
+    return nucleoEscalar;
+}
+
+// Maior double s tal que sqrt(s) <= raio. Como sqrt é corretamente
+// arredondada e monótona, sqrt(s) > raio equivale a s > limite
+double VerificadorCompatibilidade::calcularLimiteQuadrado(double raio) {
+    if (raio != raio) {
+        return raio;
+    }
+    double limite = raio * raio;
+    if (std::isinf(limite)) {
+        if (std::sqrt(limite) <= raio) {
+            return limite;
+        }
+        limite = nextafter(limite, 0.0);
+    }
+    while (limite > 0.0 && std::sqrt(limite) > raio) {
+        limite = nextafter(limite, 0.0);
+    }
+    while (true) {
+        double proximo = nextafter(limite, INFINITY);
+        if (std::sqrt(proximo) > raio) {
+            break;
+        }
+        limite = proximo;
+    }
+    return limite;
+}
+
+// Métodos privados
+
+// Copia as coordenadas dos membros (índices esparsos no store) para um buffer
+// contíguo e compara todas com a demanda nova de uma vez
+uint64_t VerificadorCompatibilidade::compararMembros(const double* coluna_x, const double* coluna_y,
+                                                     const int* membros, int quantidade, int nova,
+                                                     double limite) {
+    for (int k = 0; k < quantidade; k++) {
+        this->buffer_x[k] = coluna_x[membros[k]];
+        this->buffer_y[k] = coluna_y[membros[k]];
+    }
+    return this->nucleo(this->buffer_x, this->buffer_y, quantidade,
+                        coluna_x[nova], coluna_y[nova], limite);
+}
@@ -0,0 +1,124 @@
+// Microbenchmark da alocação de eventos na simulação
+//
+// Reproduz o laço de main(): cada corrida tem um evento pendente por vez e,
+// ao retirá-lo, o escalonador recebe o evento da parada seguinte. No modo
+// "new" cada parada faz new Evento e o evento retirado é deletado; no modo
+// "pool" os eventos vêm do EventoPool do escalonador e são devolvidos a ele.
+// Os operadores new/delete globais são contados para medir as chamadas ao
+// alocador do sistema (inclusive as do próprio escalonador).
+//
+// Uso: benchmark_pool.out <num_corridas> <paradas_por_corrida> [new|pool]
+// Saída (CSV): modo,corridas,eventos,chamadas_new,chamadas_delete,pico_vivos,segundos
+
+#include "Escalonador.hpp"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace std;
+
+static long long chamadas_new = 0;
+static long long chamadas_delete = 0;
+
+// Fora de linha: com new e malloc visíveis no mesmo ponto, o g++ acusa
+// falsamente delete sobre memória de malloc
+__attribute__((noinline)) void* operator new(size_t bytes) {
+    chamadas_new++;
+    void* memoria = malloc(bytes > 0 ? bytes : 1);
+    if (memoria == nullptr) {
+        throw bad_alloc();
+    }
+    return memoria;
+}
+
+__attribute__((noinline)) void operator delete(void* memoria) noexcept {
+    if (memoria != nullptr) {
+        chamadas_delete++;
+    }
+    free(memoria);
+}
+
+void* operator new[](size_t bytes) {
+    return operator new(bytes);
+}
+
+void operator delete[](void* memoria) noexcept {
+    operator delete(memoria);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "Uso: %s <num_corridas> <paradas_por_corrida> [new|pool]\n", argv[0]);
+        return 1;
+    }
+
+    int num_corridas = atoi(argv[1]);
+    int paradas = atoi(argv[2]);
+    const char* modo = argc >= 4 ? argv[3] : "pool";
+    bool usar_pool = strcmp(modo, "pool") == 0;
+    if (num_corridas <= 0 || paradas <= 0 || (!usar_pool && strcmp(modo, "new") != 0)) {
+        fprintf(stderr, "Parametros invalidos\n");
+        return 1;
+    }
+
+    long long new_antes = chamadas_new;
+    long long delete_antes = chamadas_delete;
+    long long vivos = 0;
+    long long pico_vivos = 0;
+    long long eventos = 0;
+    ReferenciaCorrida sem_corrida = {-1, 0};
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    {
+        Escalonador escalonador(num_corridas);
+
+        // Partidas espalhadas como chegadas de demandas
+        for (int c = 0; c < num_corridas; c++) {
+            double tempo = c * 0.1;
+            if (usar_pool) {
+                escalonador.insereEvento(tempo, COLETA_PASSAGEIRO, sem_corrida, 0);
+            } else {
+                escalonador.insereEvento(new Evento(tempo, COLETA_PASSAGEIRO, sem_corrida, 0));
+                vivos++;
+            }
+        }
+        pico_vivos = vivos;
+
+        while (!escalonador.estaVazio()) {
+            Evento* evento = escalonador.retiraProximoEvento();
+            eventos++;
+
+            int indice = evento->getIndiceParada();
+            if (indice < paradas - 1) {
+                // Trechos de 30 a 90 s, variando com a parada
+                double tempo = evento->getTempo() + 30.0 + (indice * 37) % 61;
+                if (usar_pool) {
+                    escalonador.insereEvento(tempo, ENTREGA_PASSAGEIRO, sem_corrida, indice + 1);
+                } else {
+                    escalonador.insereEvento(new Evento(tempo, ENTREGA_PASSAGEIRO, sem_corrida, indice + 1));
+                    vivos++;
+                    if (vivos > pico_vivos) {
+                        pico_vivos = vivos;
+                    }
+                }
+            }
+
+            if (usar_pool) {
+                escalonador.liberaEvento(evento);
+            } else {
+                delete evento;
+                vivos--;
+            }
+        }
+
+        if (usar_pool) {
+            pico_vivos = escalonador.getPool().getPicoVivos();
+        }
+    }
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+
+    printf("%s,%d,%lld,%lld,%lld,%lld,%.6f\n", modo, num_corridas, eventos,
+           chamadas_new - new_antes, chamadas_delete - delete_antes, pico_vivos, segundos);
+    return 0;
+}
@@ -0,0 +1,375 @@
+// Microbenchmark das filas de prioridade do escalonador
+//
+// Modelo "hold": a fila é carregada com N eventos e, em seguida, executa N
+// operações de retirar o mínimo e reinserir o mesmo evento num tempo
+// futuro, o padrão de acesso da simulação. Os objetos Evento são
+// reaproveitados para que apenas a fila seja medida.
+//
+// Uso: benchmark_fila.out <num_eventos> [binario|daria|calendario] [semente]
+// A carga inicial também é medida em lote (inserirLote), sobre os mesmos
+// tempos, numa fila separada.
+//
+// Antes da medição, a fila é conferida contra uma referência por força
+// bruta numa sequência aleatória de inserções, retiradas, atualizações de
+// tempo (para menos e para mais) e remoções, com empates frequentes; e o
+// mesmo é feito pelos handles do Escalonador com essa fila (calendário) ou
+// com o heap do executável (binario/daria), conferindo também que handles
+// de eventos já retirados ou removidos são ignorados. Cada retirada deve
+// devolver um evento presente com o menor tempo (empates em qualquer
+// ordem). Com divergências o programa termina com código 2.
+//
+// Saída (CSV): fila,aridade,eventos,carga_s,carga_lote_s,hold_s,mops_hold,checksum,operacoes_conferidas,divergencias
+
+#include "Escalonador.hpp"
+#include "FilaCalendario.hpp"
+#include "HeapBinario.hpp"
+#include "HeapDario.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+using namespace std;
+
+// Gerador xorshift64*: determinístico e igual para as duas filas
+static inline uint64_t proximoAleatorio(uint64_t& estado) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 0x2545F4914F6CDD1DULL;
+}
+
+// Incremento uniforme em [0, 100): mantém a fila em regime estacionário
+static inline double proximoIncremento(uint64_t& estado) {
+    return static_cast<double>(proximoAleatorio(estado) >> 11) * (100.0 / 9007199254740992.0);
+}
+
+static double segundosDesde(chrono::steady_clock::time_point inicio) {
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Eventos vivos da conferência e a operação sorteada a cada passo
+static const int EVENTOS_CONFERIDOS = 512;
+static const int OPERACOES_CONFERIDAS = 200000;
+
+enum OperacaoFila {
+    OPERACAO_INSERIR,
+    OPERACAO_RETIRAR,
+    OPERACAO_ATUALIZAR,
+    OPERACAO_REMOVER
+};
+
+// Referência por força bruta: os eventos presentes num array (com o handle
+// de cada um, na conferência pelo escalonador) e o mínimo por varredura
+struct Referencia {
+    Evento* vivos[EVENTOS_CONFERIDOS];
+    HandleEvento handles[EVENTOS_CONFERIDOS];
+    int num_vivos;
+    double agora;                        // Tempo da última retirada
+};
+
+static void adicionarReferencia(Referencia& referencia, Evento* evento, HandleEvento handle) {
+    referencia.vivos[referencia.num_vivos] = evento;
+    referencia.handles[referencia.num_vivos] = handle;
+    referencia.num_vivos++;
+}
+
+// Tira o evento da referência; -1 se ele não estava presente
+static int retirarReferencia(Referencia& referencia, Evento* evento, HandleEvento& handle) {
+    for (int k = 0; k < referencia.num_vivos; k++) {
+        if (referencia.vivos[k] == evento) {
+            handle = referencia.handles[k];
+            referencia.num_vivos--;
+            referencia.vivos[k] = referencia.vivos[referencia.num_vivos];
+            referencia.handles[k] = referencia.handles[referencia.num_vivos];
+            return k;
+        }
+    }
+    return -1;
+}
+
+static double menorTempoReferencia(const Referencia& referencia) {
+    double menor = referencia.vivos[0]->getTempo();
+    for (int k = 1; k < referencia.num_vivos; k++) {
+        if (referencia.vivos[k]->getTempo() < menor) {
+            menor = referencia.vivos[k]->getTempo();
+        }
+    }
+    return menor;
+}
+
+// Tempo de uma inserção ou atualização: em geral depois da última
+// retirada, às vezes antes dela; um em quatro em múltiplos de 0,5 (empates)
+static double sortearTempo(uint64_t& estado, double agora) {
+    double tempo = agora + proximoIncremento(estado);
+    switch (proximoAleatorio(estado) % 8) {
+        case 0: tempo = agora * proximoIncremento(estado) / 100.0; break;
+        case 1: case 2: tempo = static_cast<double>(static_cast<long long>(tempo * 2.0)) / 2.0; break;
+    }
+    return tempo;
+}
+
+static OperacaoFila sortearOperacao(uint64_t& estado, const Referencia& referencia) {
+    int sorteio = static_cast<int>(proximoAleatorio(estado) % 100);
+    if (referencia.num_vivos == 0 || (sorteio < 35 && referencia.num_vivos < EVENTOS_CONFERIDOS)) {
+        return OPERACAO_INSERIR;
+    }
+    if (sorteio < 60) {
+        return OPERACAO_RETIRAR;
+    }
+    return sorteio < 85 ? OPERACAO_ATUALIZAR : OPERACAO_REMOVER;
+}
+
+static void registrarDivergencia(const char* fila, int passo, const char* descricao, long long& divergencias) {
+    if (divergencias < 10) {
+        fprintf(stderr, "Divergencia (%s, passo %d): %s\n", fila, passo, descricao);
+    }
+    divergencias++;
+}
+
+// Confere uma retirada contra a referência e avança o relógio
+static void conferirRetirada(const char* nome, int passo, Referencia& referencia, Evento* evento,
+                             HandleEvento& handle, long long& conferidas, long long& divergencias) {
+    conferidas++;
+    if (evento == nullptr) {
+        registrarDivergencia(nome, passo, "fila vazia com eventos presentes", divergencias);
+        return;
+    }
+    double esperado = menorTempoReferencia(referencia);
+    if (retirarReferencia(referencia, evento, handle) < 0) {
+        registrarDivergencia(nome, passo, "retirado um evento ausente", divergencias);
+        return;
+    }
+    if (evento->getTempo() != esperado) {
+        registrarDivergencia(nome, passo, "retirado um evento fora do menor tempo", divergencias);
+    }
+    referencia.agora = evento->getTempo();
+}
+
+// Conferência direta da fila (sem handles)
+template <typename Fila>
+static void conferirFila(const char* nome, uint64_t& estado, long long& conferidas, long long& divergencias) {
+    Evento* eventos = new Evento[EVENTOS_CONFERIDOS];
+    Evento* livres[EVENTOS_CONFERIDOS];
+    int num_livres = EVENTOS_CONFERIDOS;
+    for (int k = 0; k < EVENTOS_CONFERIDOS; k++) {
+        livres[k] = &eventos[k];
+    }
+    Referencia referencia;
+    referencia.num_vivos = 0;
+    referencia.agora = 0.0;
+    HandleEvento nenhum;
+    nenhum.indice = -1;
+    nenhum.geracao = 0;
+
+    Fila fila(16);
+    for (int passo = 0; passo < OPERACOES_CONFERIDAS || referencia.num_vivos > 0; passo++) {
+        OperacaoFila operacao = passo < OPERACOES_CONFERIDAS ? sortearOperacao(estado, referencia) : OPERACAO_RETIRAR;
+        Evento* evento = referencia.num_vivos > 0
+                       ? referencia.vivos[proximoAleatorio(estado) % referencia.num_vivos] : nullptr;
+        HandleEvento handle;
+        switch (operacao) {
+            case OPERACAO_INSERIR:
+                evento = livres[--num_livres];
+                evento->setTempo(sortearTempo(estado, referencia.agora));
+                fila.inserir(evento);
+                adicionarReferencia(referencia, evento, nenhum);
+                break;
+            case OPERACAO_RETIRAR:
+                evento = fila.retirarMinimo();
+                conferirRetirada(nome, passo, referencia, evento, handle, conferidas, divergencias);
+                if (evento != nullptr) {
+                    livres[num_livres++] = evento;
+                }
+                break;
+            case OPERACAO_ATUALIZAR:
+                evento->setTempo(proximoAleatorio(estado) % 2 == 0 ? evento->getTempo() * 0.5
+                                                                   : sortearTempo(estado, evento->getTempo()));
+                fila.atualizar(evento);
+                break;
+            case OPERACAO_REMOVER:
+                fila.remover(evento);
+                retirarReferencia(referencia, evento, handle);
+                livres[num_livres++] = evento;
+                break;
+        }
+
+        conferidas++;
+        if (fila.getTamanho() != referencia.num_vivos) {
+            registrarDivergencia(nome, passo, "tamanho diferente da referencia", divergencias);
+        } else if (referencia.num_vivos > 0 && fila.getTempoMinimo() != menorTempoReferencia(referencia)) {
+            registrarDivergencia(nome, passo, "tempo minimo diferente da referencia", divergencias);
+        }
+    }
+    delete[] eventos;
+}
+
+// Conferência pelos handles do escalonador: os eventos vêm do pool dele, e
+// os handles de eventos que saíram da fila devem ser ignorados
+static void conferirHandles(const char* nome, TipoFilaEventos tipo, uint64_t& estado, long long& conferidas,
+                            long long& divergencias) {
+    Escalonador escalonador(16, nullptr, tipo);
+    Referencia referencia;
+    referencia.num_vivos = 0;
+    referencia.agora = 0.0;
+    HandleEvento antigos[64];
+    int num_antigos = 0;
+    ReferenciaCorrida corrida;
+    corrida.indice = -1;
+    corrida.geracao = 0;
+
+    for (int passo = 0; passo < OPERACOES_CONFERIDAS || referencia.num_vivos > 0; passo++) {
+        OperacaoFila operacao = passo < OPERACOES_CONFERIDAS ? sortearOperacao(estado, referencia) : OPERACAO_RETIRAR;
+        int sorteado = referencia.num_vivos > 0 ? static_cast<int>(proximoAleatorio(estado) % referencia.num_vivos) : -1;
+        Evento* evento = nullptr;
+        HandleEvento handle;
+        handle.indice = -1;
+        handle.geracao = 0;
+        switch (operacao) {
+            case OPERACAO_INSERIR:
+                evento = escalonador.criaEvento(sortearTempo(estado, referencia.agora), COLETA_PASSAGEIRO, corrida, 0);
+                adicionarReferencia(referencia, evento, escalonador.insereEvento(evento));
+                break;
+            case OPERACAO_RETIRAR:
+                evento = escalonador.retiraProximoEvento();
+                conferirRetirada(nome, passo, referencia, evento, handle, conferidas, divergencias);
+                break;
+            case OPERACAO_ATUALIZAR: {
+                evento = referencia.vivos[sorteado];
+                double tempo = proximoAleatorio(estado) % 2 == 0 ? evento->getTempo() * 0.5
+                                                                 : sortearTempo(estado, evento->getTempo());
+                conferidas++;
+                if (!escalonador.atualizaEvento(referencia.handles[sorteado], tempo) || evento->getTempo() != tempo) {
+                    registrarDivergencia(nome, passo, "handle vivo nao atualizado", divergencias);
+                }
+                evento = nullptr;
+                break;
+            }
+            case OPERACAO_REMOVER:
+                handle = referencia.handles[sorteado];
+                evento = escalonador.removeEvento(handle);
+                conferidas++;
+                if (evento != referencia.vivos[sorteado]) {
+                    registrarDivergencia(nome, passo, "handle vivo nao removeu o seu evento", divergencias);
+                    evento = nullptr;
+                } else {
+                    retirarReferencia(referencia, evento, handle);
+                }
+                break;
+        }
+
+        // O evento que saiu da fila volta ao pool, e o seu handle passa a ser antigo
+        if (evento != nullptr && operacao != OPERACAO_INSERIR) {
+            escalonador.liberaEvento(evento);
+            antigos[num_antigos % 64] = handle;
+            num_antigos++;
+        }
+        if (num_antigos > 0) {
+            HandleEvento antigo = antigos[proximoAleatorio(estado) % (num_antigos < 64 ? num_antigos : 64)];
+            conferidas++;
+            if (escalonador.getEvento(antigo) != nullptr || escalonador.atualizaEvento(antigo, 0.0) ||
+                escalonador.removeEvento(antigo) != nullptr) {
+                registrarDivergencia(nome, passo, "handle antigo ainda resolve", divergencias);
+            }
+        }
+
+        conferidas++;
+        if (escalonador.getTamanho() != referencia.num_vivos) {
+            registrarDivergencia(nome, passo, "tamanho diferente da referencia", divergencias);
+        } else if (referencia.num_vivos > 0 &&
+                   escalonador.getTempoProximoEvento() != menorTempoReferencia(referencia)) {
+            registrarDivergencia(nome, passo, "tempo minimo diferente da referencia", divergencias);
+        }
+    }
+}
+
+template <typename Fila>
+static int executar(const char* nome, int aridade, int num_eventos, uint64_t semente, TipoFilaEventos tipo) {
+    Evento* eventos = new (nothrow) Evento[num_eventos];
+    if (eventos == nullptr) {
+        fprintf(stderr, "Memoria insuficiente para %d eventos\n", num_eventos);
+        return 1;
+    }
+    uint64_t estado = semente;
+
+    long long conferidas = 0;
+    long long divergencias = 0;
+    conferirFila<Fila>(nome, estado, conferidas, divergencias);
+    conferirHandles(nome, tipo, estado, conferidas, divergencias);
+
+    Evento** ponteiros = new Evento*[num_eventos];
+    for (int i = 0; i < num_eventos; i++) {
+        eventos[i].setTempo(proximoIncremento(estado));
+        ponteiros[i] = &eventos[i];
+    }
+
+    // Carga inicial evento a evento e em lote (mesmos tempos)
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    Fila fila(num_eventos);
+    for (int i = 0; i < num_eventos; i++) {
+        fila.inserir(ponteiros[i]);
+    }
+    double segundos_carga = segundosDesde(inicio);
+
+    double segundos_carga_lote;
+    {
+        inicio = chrono::steady_clock::now();
+        Fila fila_lote(num_eventos);
+        fila_lote.inserirLote(ponteiros, num_eventos);
+        segundos_carga_lote = segundosDesde(inicio);
+    }
+    delete[] ponteiros;
+
+    // O checksum soma os tempos retirados: depende só da ordem por tempo,
+    // então deve coincidir entre as filas para a mesma semente
+    double checksum = 0.0;
+    inicio = chrono::steady_clock::now();
+    for (int i = 0; i < num_eventos; i++) {
+        Evento* evento = fila.retirarMinimo();
+        checksum += evento->getTempo();
+        evento->setTempo(evento->getTempo() + proximoIncremento(estado));
+        fila.inserir(evento);
+    }
+    double segundos_hold = segundosDesde(inicio);
+
+    printf("%s,%d,%d,%.6f,%.6f,%.6f,%.3f,%.6e,%lld,%lld\n", nome, aridade, num_eventos,
+           segundos_carga, segundos_carga_lote, segundos_hold, num_eventos / segundos_hold / 1e6, checksum,
+           conferidas, divergencias);
+
+    delete[] eventos;
+    return divergencias == 0 ? 0 : 2;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <num_eventos> [binario|daria|calendario] [semente]\n", argv[0]);
+        return 1;
+    }
+
+    long num_eventos = strtol(argv[1], nullptr, 10);
+    if (num_eventos <= 0 || num_eventos > 1000000000L) {
+        fprintf(stderr, "Numero de eventos invalido: %s\n", argv[1]);
+        return 1;
+    }
+    const char* fila = argc >= 3 ? argv[2] : "binario";
+    uint64_t semente = argc >= 4 ? strtoull(argv[3], nullptr, 10) : 88172645463325252ULL;
+    if (semente == 0) {
+        semente = 1;
+    }
+
+    if (strcmp(fila, "binario") == 0) {
+        return executar<HeapBinario>("binario", 2, static_cast<int>(num_eventos), semente, FILA_HEAP);
+    }
+    if (strcmp(fila, "daria") == 0) {
+        return executar<HeapDario>("daria", HeapDario::ARIDADE, static_cast<int>(num_eventos), semente,
+                                   FILA_HEAP);
+    }
+    if (strcmp(fila, "calendario") == 0) {
+        return executar<FilaCalendario>("calendario", 0, static_cast<int>(num_eventos), semente,
+                                        FILA_CALENDARIO);
+    }
+    fprintf(stderr, "Fila desconhecida: %s (use binario, daria ou calendario)\n", fila);
+    return 1;
+}
@@ -0,0 +1,138 @@
+// Microbenchmark da ordenação dos resultados
+//
+// Compara o radix sort do OrdenadorResultados (1 thread e N threads) com o
+// quicksort recursivo usado antes (Lomuto, pivô no último elemento) em
+// entradas ordenadas, invertidas e aleatórias. O quicksort é quadrático e
+// recursa até a profundidade n nas entradas ordenadas e invertidas, por isso
+// só roda até LIMITE_QUICKSORT elementos. Cada saída do radix é conferida:
+// ordem crescente e empates na ordem de entrada (estabilidade).
+//
+// Uso: benchmark_ordenacao.out <num_resultados> <ordenada|invertida|aleatoria> [threads]
+// Saída (CSV): entrada,n,quicksort_s,radix_1_s,radix_n_s,threads,estavel
+
+#include "OrdenadorResultados.hpp"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+static const int LIMITE_QUICKSORT = 100000;
+
+// Tempos com duas casas e muitos empates, como na saída da simulação
+static double tempoOrdenado(int i) {
+    return (i / 4) * 0.25;
+}
+
+static void trocarResultados(ResultadoCorrida& a, ResultadoCorrida& b) {
+    ResultadoCorrida temp = a;
+    a = b;
+    b = temp;
+}
+
+static int particionar(ResultadoCorrida* resultados, int inicio, int fim) {
+    double pivo = resultados[fim].tempo_conclusao;
+    int i = inicio - 1;
+    for (int j = inicio; j < fim; j++) {
+        if (resultados[j].tempo_conclusao <= pivo) {
+            i++;
+            trocarResultados(resultados[i], resultados[j]);
+        }
+    }
+    trocarResultados(resultados[i + 1], resultados[fim]);
+    return i + 1;
+}
+
+static void quicksort(ResultadoCorrida* resultados, int inicio, int fim) {
+    if (inicio < fim) {
+        int pivo = particionar(resultados, inicio, fim);
+        quicksort(resultados, inicio, pivo - 1);
+        quicksort(resultados, pivo + 1, fim);
+    }
+}
+
+static double segundosDesde(chrono::steady_clock::time_point inicio) {
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// O "ponteiro" de corrida guarda a posição original para conferir a estabilidade
+static bool conferir(const ResultadoCorrida* resultados, int n) {
+    for (int i = 1; i < n; i++) {
+        if (resultados[i - 1].tempo_conclusao > resultados[i].tempo_conclusao) {
+            return false;
+        }
+        if (resultados[i - 1].tempo_conclusao == resultados[i].tempo_conclusao &&
+            reinterpret_cast<uintptr_t>(resultados[i - 1].corrida) > reinterpret_cast<uintptr_t>(resultados[i].corrida)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3) {
+        fprintf(stderr, "Uso: %s <num_resultados> <ordenada|invertida|aleatoria> [threads]\n", argv[0]);
+        return 1;
+    }
+
+    int n = atoi(argv[1]);
+    const char* entrada = argv[2];
+    int threads = argc >= 4 ? atoi(argv[3]) : 4;
+    if (n <= 0 || threads <= 0) {
+        fprintf(stderr, "Parametros invalidos\n");
+        return 1;
+    }
+
+    ResultadoCorrida* base = new ResultadoCorrida[n];
+    uint64_t estado = 88172645463325252ULL;
+    for (int i = 0; i < n; i++) {
+        if (strcmp(entrada, "ordenada") == 0) {
+            base[i].tempo_conclusao = tempoOrdenado(i);
+        } else if (strcmp(entrada, "invertida") == 0) {
+            base[i].tempo_conclusao = tempoOrdenado(n - 1 - i);
+        } else if (strcmp(entrada, "aleatoria") == 0) {
+            estado ^= estado << 13;
+            estado ^= estado >> 7;
+            estado ^= estado << 17;
+            base[i].tempo_conclusao = static_cast<double>(estado % 10000000) / 100.0;
+        } else {
+            fprintf(stderr, "Entrada desconhecida: %s\n", entrada);
+            return 1;
+        }
+        base[i].corrida = reinterpret_cast<Corrida*>(static_cast<uintptr_t>(i));
+    }
+
+    ResultadoCorrida* copia = new ResultadoCorrida[n];
+    bool estavel = true;
+
+    char quicksort_s[32] = "-";
+    if (n <= LIMITE_QUICKSORT) {
+        memcpy(copia, base, sizeof(ResultadoCorrida) * n);
+        chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+        quicksort(copia, 0, n - 1);
+        snprintf(quicksort_s, sizeof(quicksort_s), "%.6f", segundosDesde(inicio));
+    }
+
+    memcpy(copia, base, sizeof(ResultadoCorrida) * n);
+    OrdenadorResultados sequencial(1);
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    sequencial.ordenar(copia, n);
+    double radix_1_s = segundosDesde(inicio);
+    estavel = estavel && conferir(copia, n);
+
+    memcpy(copia, base, sizeof(ResultadoCorrida) * n);
+    OrdenadorResultados paralelo(threads);
+    inicio = chrono::steady_clock::now();
+    paralelo.ordenar(copia, n);
+    double radix_n_s = segundosDesde(inicio);
+    estavel = estavel && conferir(copia, n);
+
+    printf("%s,%d,%s,%.6f,%.6f,%d,%s\n", entrada, n, quicksort_s, radix_1_s, radix_n_s, threads,
+           estavel ? "sim" : "nao");
+
+    delete[] base;
+    delete[] copia;
+    return estavel ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// Microbenchmark e verificação da escrita da saída
+//
+// Gera linhas no formato da saída (3 decimais, um inteiro e 2k coordenadas)
+// e as escreve de dois modos: "fixed << setprecision(2)" com endl a cada
+// linha, como o imprimirCorrida original, e pelo EscritorSaida. Antes de
+// medir, confere cada valor gerado contra o texto do ostringstream, além de
+// casos difíceis: empates exatos em x.xx5 (múltiplos de 1/8), vizinhos de
+// cada um (nextafter), subnormais, zeros com sinal e valores grandes.
+//
+// Uso: benchmark_saida.out <linhas> [semente]
+// Os dois modos escrevem em /dev/null, então o tempo é o de formatação e
+// das chamadas de escrita, sem disco.
+//
+// Saída (CSV): linhas,valores_conferidos,divergencias,iostream_s,escritor_s,mb_escritor_s
+
+#include "EscritorSaida.hpp"
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+
+static const int PARADAS_POR_LINHA = 4;
+
+// Gerador xorshift64*
+static inline uint64_t proximoAleatorio(uint64_t& estado) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 0x2545F4914F6CDD1DULL;
+}
+
+static inline double uniforme(uint64_t& estado) {
+    return static_cast<double>(proximoAleatorio(estado) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double segundosDesde(chrono::steady_clock::time_point inicio) {
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Compara o EscritorSaida com o ostringstream; reporta as primeiras divergências
+static bool conferir(double valor, long long& divergencias) {
+    ostringstream esperado;
+    esperado << fixed << setprecision(2) << valor;
+
+    char obtido[EscritorSaida::TAMANHO_MAXIMO_DECIMAL];
+    int tamanho = EscritorSaida::formatarDecimal2(valor, obtido);
+    if (esperado.str() == string(obtido, tamanho)) {
+        return true;
+    }
+    if (divergencias < 10) {
+        fprintf(stderr, "Divergencia em %.17g: esperado \"%s\", obtido \"%.*s\"\n", valor,
+                esperado.str().c_str(), tamanho, obtido);
+    }
+    divergencias++;
+    return false;
+}
+
+static long long conferirCasosDificeis(long long& divergencias) {
+    long long conferidos = 0;
+
+    // Empates exatos k/8 (x.125, x.375, ...) e seus vizinhos, com os dois sinais
+    for (long long k = 0; k <= 800000; k++) {
+        double base = static_cast<double>(k) / 8.0;
+        double casos[3] = {base, nextafter(base, INFINITY), nextafter(base, -INFINITY)};
+        for (int c = 0; c < 3; c++) {
+            conferir(casos[c], divergencias);
+            conferir(-casos[c], divergencias);
+            conferidos += 2;
+        }
+    }
+
+    // Valores x.xx5 decimais (não exatos em binário), em várias magnitudes
+    for (long long k = 0; k < 200000; k++) {
+        double valor = (static_cast<double>(k) * 10.0 + 5.0) / 1000.0;
+        conferir(valor, divergencias);
+        conferir(valor * 1e6, divergencias);
+        conferidos += 2;
+    }
+
+    // Extremos: zeros, subnormais, limites da faixa rápida, infinitos e NaN
+    double extremos[] = {0.0, -0.0, 4.9e-324, -4.9e-324, 2.2250738585072014e-308, 0.005, 0.015,
+                         0.025, 1e-3, 0.995, 9.995, 999999.995, 4503599627370495.5, 4503599627370496.0,
+                         9007199254740991.0, 9007199254740992.0, 9007199254740993.0, 1e17, DBL_MAX,
+                         -DBL_MAX, INFINITY, -INFINITY, NAN};
+    for (size_t i = 0; i < sizeof(extremos) / sizeof(extremos[0]); i++) {
+        conferir(extremos[i], divergencias);
+        conferidos++;
+    }
+    return conferidos;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <linhas> [semente]\n", argv[0]);
+        return 1;
+    }
+
+    long linhas = strtol(argv[1], nullptr, 10);
+    if (linhas <= 0 || linhas > 100000000L) {
+        fprintf(stderr, "Numero de linhas invalido: %s\n", argv[1]);
+        return 1;
+    }
+    uint64_t semente = argc >= 3 ? strtoull(argv[2], nullptr, 10) : 88172645463325252ULL;
+    if (semente == 0) {
+        semente = 1;
+    }
+
+    // Valores no formato da saída: tempos crescentes, distâncias,
+    // eficiências em [0, 1] e coordenadas ~ 600 x 7800
+    int valores_por_linha = 3 + 2 * PARADAS_POR_LINHA;
+    double* valores = new double[static_cast<size_t>(linhas) * valores_por_linha];
+    uint64_t estado = semente;
+    double tempo = 0.0;
+    for (long l = 0; l < linhas; l++) {
+        double* linha = valores + static_cast<size_t>(l) * valores_por_linha;
+        tempo += uniforme(estado) * 10.0;
+        linha[0] = tempo;
+        linha[1] = uniforme(estado) * 50.0;
+        linha[2] = uniforme(estado);
+        for (int p = 0; p < PARADAS_POR_LINHA; p++) {
+            linha[3 + 2 * p] = 590.0 + uniforme(estado) * 40.0;
+            linha[4 + 2 * p] = 7780.0 + uniforme(estado) * 40.0;
+        }
+    }
+
+    long long divergencias = 0;
+    long long conferidos = conferirCasosDificeis(divergencias);
+    for (size_t i = 0; i < static_cast<size_t>(linhas) * valores_por_linha; i++) {
+        conferir(valores[i], divergencias);
+        conferidos++;
+    }
+
+    ofstream nulo_iostream("/dev/null");
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    for (long l = 0; l < linhas; l++) {
+        const double* linha = valores + static_cast<size_t>(l) * valores_por_linha;
+        nulo_iostream << fixed << setprecision(2);
+        nulo_iostream << linha[0] << " " << linha[1] << " " << linha[2] << " " << PARADAS_POR_LINHA;
+        for (int p = 0; p < PARADAS_POR_LINHA; p++) {
+            nulo_iostream << " " << linha[3 + 2 * p] << " " << linha[4 + 2 * p];
+        }
+        nulo_iostream << endl;
+    }
+    double segundos_iostream = segundosDesde(inicio);
+
+    ofstream nulo_escritor("/dev/null");
+    unsigned long long bytes;
+    inicio = chrono::steady_clock::now();
+    {
+        EscritorSaida escritor(nulo_escritor);
+        for (long l = 0; l < linhas; l++) {
+            const double* linha = valores + static_cast<size_t>(l) * valores_por_linha;
+            escritor.escreverDecimal2(linha[0]);
+            escritor.escreverCaractere(' ');
+            escritor.escreverDecimal2(linha[1]);
+            escritor.escreverCaractere(' ');
+            escritor.escreverDecimal2(linha[2]);
+            escritor.escreverCaractere(' ');
+            escritor.escreverInteiro(PARADAS_POR_LINHA);
+            for (int p = 0; p < PARADAS_POR_LINHA; p++) {
+                escritor.escreverCaractere(' ');
+                escritor.escreverDecimal2(linha[3 + 2 * p]);
+                escritor.escreverCaractere(' ');
+                escritor.escreverDecimal2(linha[4 + 2 * p]);
+            }
+            escritor.escreverCaractere('\n');
+        }
+        escritor.descarregar();
+        bytes = escritor.getBytesEscritos();
+    }
+    double segundos_escritor = segundosDesde(inicio);
+
+    printf("%ld,%lld,%lld,%.6f,%.6f,%.1f\n", linhas, conferidos, divergencias, segundos_iostream,
+           segundos_escritor, bytes / segundos_escritor / 1e6);
+
+    delete[] valores;
+    return divergencias == 0 ? 0 : 2;
+}
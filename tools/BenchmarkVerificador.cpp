@@ -0,0 +1,202 @@
+// Microbenchmark e verificação dos núcleos do VerificadorCompatibilidade
+//
+// Confere as máscaras dos núcleos SSE2 e AVX2 contra o núcleo escalar, e o
+// escalar contra o critério original !(sqrt(dx * dx + dy * dy) > raio), com
+// o limite de calcularLimiteQuadrado. Cobre blocos aleatórios de todos os
+// tamanhos de 1 a 64 (inclusive os parciais, que terminam no caminho
+// escalar ou SSE2), pontos exatamente no raio e nos seus vizinhos
+// (nextafter, nos dois eixos e na diagonal) e coordenadas NaN e infinitas.
+// Depois mede cada núcleo sobre blocos cheios.
+//
+// Uso: benchmark_verificador.out <blocos> [semente]
+// Núcleos não suportados pelo processador caem no mais largo disponível
+// (o nome efetivo aparece no CSV).
+//
+// Saída (CSV): blocos,mascaras_conferidas,divergencias,escalar_s,sse2_s,avx2_s,isa_sse2,isa_avx2
+
+#include "VerificadorCompatibilidade.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+
+static const int LOTE = VerificadorCompatibilidade::TAMANHO_LOTE;
+
+// Gerador xorshift64*
+static inline uint64_t proximoAleatorio(uint64_t& estado) {
+    estado ^= estado >> 12;
+    estado ^= estado << 25;
+    estado ^= estado >> 27;
+    return estado * 0x2545F4914F6CDD1DULL;
+}
+
+static inline double uniforme(uint64_t& estado) {
+    return static_cast<double>(proximoAleatorio(estado) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double segundosDesde(chrono::steady_clock::time_point inicio) {
+    return chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+}
+
+// Máscara do critério original, ponto a ponto
+static uint64_t mascaraReferencia(const double* xs, const double* ys, int quantidade, double px, double py,
+                                  double raio) {
+    uint64_t mascara = 0;
+    for (int k = 0; k < quantidade; k++) {
+        double dx = xs[k] - px;
+        double dy = ys[k] - py;
+        if (!(sqrt(dx * dx + dy * dy) > raio)) {
+            mascara |= 1ULL << k;
+        }
+    }
+    return mascara;
+}
+
+struct Nucleos {
+    VerificadorCompatibilidade::Nucleo escalar, sse2, avx2;
+};
+
+// Compara os três núcleos e a referência num bloco; reporta as primeiras divergências
+static void conferir(const Nucleos& nucleos, const double* xs, const double* ys, int quantidade, double px,
+                     double py, double raio, long long& conferidas, long long& divergencias) {
+    double limite = VerificadorCompatibilidade::calcularLimiteQuadrado(raio);
+    uint64_t esperada = mascaraReferencia(xs, ys, quantidade, px, py, raio);
+    uint64_t obtidas[3] = {nucleos.escalar(xs, ys, quantidade, px, py, limite),
+                           nucleos.sse2(xs, ys, quantidade, px, py, limite),
+                           nucleos.avx2(xs, ys, quantidade, px, py, limite)};
+    const char* nomes[3] = {"escalar", "sse2", "avx2"};
+    for (int n = 0; n < 3; n++) {
+        conferidas++;
+        if (obtidas[n] == esperada) {
+            continue;
+        }
+        if (divergencias < 10) {
+            fprintf(stderr, "Divergencia (%s, %d pontos, p = (%.17g, %.17g), raio %.17g): esperado %016llx, "
+                    "obtido %016llx\n", nomes[n], quantidade, px, py, raio,
+                    static_cast<unsigned long long>(esperada), static_cast<unsigned long long>(obtidas[n]));
+        }
+        divergencias++;
+    }
+}
+
+// Pontos no raio e vizinhos, NaN e infinitos, em blocos de todos os tamanhos
+static void conferirCasosDificeis(const Nucleos& nucleos, uint64_t& estado, long long& conferidas,
+                                  long long& divergencias) {
+    double especiais[] = {NAN, INFINITY, -INFINITY, 0.0, -0.0, 1e308, -1e308, 4.9e-324};
+    int num_especiais = sizeof(especiais) / sizeof(especiais[0]);
+    double raios[] = {0.0, 1.0, 0.1, 3.0, 400.0, 1234.5678, 1e-300, 1e154, 1e200, INFINITY, NAN};
+    int num_raios = sizeof(raios) / sizeof(raios[0]);
+
+    double xs[LOTE], ys[LOTE];
+    for (int r = 0; r < num_raios; r++) {
+        double raio = raios[r];
+        double px = 600.0 + uniforme(estado);
+        double py = 7800.0 + uniforme(estado);
+        for (int quantidade = 1; quantidade <= LOTE; quantidade++) {
+            for (int k = 0; k < quantidade; k++) {
+                // Raio exato e vizinhos em x, em y e na diagonal
+                double deslocamento = raio;
+                switch (proximoAleatorio(estado) % 3) {
+                    case 1: deslocamento = nextafter(raio, INFINITY); break;
+                    case 2: deslocamento = nextafter(raio, -INFINITY); break;
+                }
+                switch (proximoAleatorio(estado) % 4) {
+                    case 0: xs[k] = px + deslocamento; ys[k] = py; break;
+                    case 1: xs[k] = px; ys[k] = py - deslocamento; break;
+                    case 2: xs[k] = px + deslocamento / sqrt(2.0); ys[k] = py + deslocamento / sqrt(2.0); break;
+                    default: xs[k] = nextafter(px + deslocamento, px); ys[k] = py; break;
+                }
+                // Coordenadas especiais em parte dos pontos
+                if (proximoAleatorio(estado) % 8 == 0) {
+                    xs[k] = especiais[proximoAleatorio(estado) % num_especiais];
+                }
+                if (proximoAleatorio(estado) % 8 == 0) {
+                    ys[k] = especiais[proximoAleatorio(estado) % num_especiais];
+                }
+            }
+            conferir(nucleos, xs, ys, quantidade, px, py, raio, conferidas, divergencias);
+
+            // O mesmo bloco visto de um ponto especial
+            double qx = especiais[proximoAleatorio(estado) % num_especiais];
+            conferir(nucleos, xs, ys, quantidade, qx, py, raio, conferidas, divergencias);
+        }
+    }
+}
+
+static double medir(VerificadorCompatibilidade::Nucleo nucleo, const double* xs, const double* ys, long blocos,
+                    double limite, uint64_t& acumulado) {
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    for (long b = 0; b < blocos; b++) {
+        acumulado += nucleo(xs + (b % 1024) * LOTE, ys + (b % 1024) * LOTE, LOTE, 600.0, 7800.0, limite);
+    }
+    return segundosDesde(inicio);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Uso: %s <blocos> [semente]\n", argv[0]);
+        return 1;
+    }
+
+    long blocos = strtol(argv[1], nullptr, 10);
+    if (blocos <= 0 || blocos > 1000000000L) {
+        fprintf(stderr, "Numero de blocos invalido: %s\n", argv[1]);
+        return 1;
+    }
+    uint64_t semente = argc >= 3 ? strtoull(argv[2], nullptr, 10) : 88172645463325252ULL;
+    if (semente == 0) {
+        semente = 1;
+    }
+
+    Nucleos nucleos;
+    nucleos.escalar = VerificadorCompatibilidade::obterNucleo(ISA_ESCALAR);
+    nucleos.sse2 = VerificadorCompatibilidade::obterNucleo(ISA_SSE2);
+    nucleos.avx2 = VerificadorCompatibilidade::obterNucleo(ISA_AVX2);
+    ConjuntoInstrucoes disponivel = VerificadorCompatibilidade::detectarConjuntoInstrucoes();
+    ConjuntoInstrucoes isa_sse2 = disponivel < ISA_SSE2 ? disponivel : ISA_SSE2;
+    ConjuntoInstrucoes isa_avx2 = disponivel < ISA_AVX2 ? disponivel : ISA_AVX2;
+
+    // Coordenadas como as das entradas (~ 600 x 7800), 1024 blocos reaproveitados na medição
+    double* xs = new double[1024 * LOTE];
+    double* ys = new double[1024 * LOTE];
+    uint64_t estado = semente;
+    for (int i = 0; i < 1024 * LOTE; i++) {
+        xs[i] = 590.0 + uniforme(estado) * 40.0;
+        ys[i] = 7780.0 + uniforme(estado) * 40.0;
+    }
+
+    long long conferidas = 0;
+    long long divergencias = 0;
+    conferirCasosDificeis(nucleos, estado, conferidas, divergencias);
+
+    // Blocos aleatórios de todos os tamanhos, com raios próximos das distâncias
+    long blocos_conferidos = blocos < 200000 ? blocos : 200000;
+    for (long b = 0; b < blocos_conferidos; b++) {
+        int quantidade = 1 + static_cast<int>(proximoAleatorio(estado) % LOTE);
+        const double* bx = xs + (b % 1024) * LOTE;
+        const double* by = ys + (b % 1024) * LOTE;
+        double raio = uniforme(estado) * 40.0;
+        conferir(nucleos, bx, by, quantidade, 600.0 + uniforme(estado) * 20.0, 7800.0 + uniforme(estado) * 20.0,
+                 raio, conferidas, divergencias);
+    }
+
+    double limite = VerificadorCompatibilidade::calcularLimiteQuadrado(15.0);
+    uint64_t acumulado = 0;
+    double segundos_escalar = medir(nucleos.escalar, xs, ys, blocos, limite, acumulado);
+    double segundos_sse2 = medir(nucleos.sse2, xs, ys, blocos, limite, acumulado);
+    double segundos_avx2 = medir(nucleos.avx2, xs, ys, blocos, limite, acumulado);
+
+    printf("%ld,%lld,%lld,%.6f,%.6f,%.6f,%s,%s\n", blocos, conferidas, divergencias, segundos_escalar,
+           segundos_sse2, segundos_avx2, VerificadorCompatibilidade::nomeConjuntoInstrucoes(isa_sse2),
+           VerificadorCompatibilidade::nomeConjuntoInstrucoes(isa_avx2));
+    if (acumulado == 1) {
+        fprintf(stderr, "(acumulado %llu)\n", static_cast<unsigned long long>(acumulado));
+    }
+
+    delete[] xs;
+    delete[] ys;
+    return divergencias == 0 ? 0 : 2;
+}
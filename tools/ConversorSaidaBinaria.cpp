@@ -0,0 +1,64 @@
+// Conversor da saída binária colunar (--formato=binario) para o formato
+// texto do imprimirCorrida, byte a byte igual ao da execução em texto:
+// <tempo_conclusão> <distância_total> <eficiência> <num_paradas> <x1> <y1> ...
+//
+// Uso: conversor_saida.out [arquivo]   (sem arquivo, lê da entrada padrão)
+
+#include "EscritorSaida.hpp"
+#include "LeitorSaidaBinaria.hpp"
+#include <cstdio>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+
+using namespace std;
+
+int main(int argc, char* argv[]) {
+    int descritor = 0;
+    if (argc >= 2) {
+        descritor = open(argv[1], O_RDONLY);
+        if (descritor < 0) {
+            fprintf(stderr, "Nao foi possivel abrir %s\n", argv[1]);
+            return 1;
+        }
+    }
+
+    LeitorSaidaBinaria leitor(descritor);
+    if (descritor != 0) {
+        close(descritor);
+    }
+    if (!leitor.valido()) {
+        fprintf(stderr, "Saida binaria invalida: %s\n", leitor.getErro());
+        return 1;
+    }
+    if (!leitor.verificarParadas()) {
+        fprintf(stderr, "Saida binaria invalida: inicio_paradas incoerente com num_paradas\n");
+        return 1;
+    }
+
+    const double* tempos = leitor.getTemposConclusao();
+    const double* distancias = leitor.getDistanciasTotais();
+    const double* eficiencias = leitor.getEficiencias();
+    const int32_t* num_paradas = leitor.getNumParadas();
+    const int64_t* inicio_paradas = leitor.getInicioParadas();
+    const double* coordenadas = leitor.getCoordenadas();
+
+    EscritorSaida escritor(cout);
+    for (uint64_t i = 0; i < leitor.getNumCorridas(); i++) {
+        escritor.escreverDecimal2(tempos[i]);
+        escritor.escreverCaractere(' ');
+        escritor.escreverDecimal2(distancias[i]);
+        escritor.escreverCaractere(' ');
+        escritor.escreverDecimal2(eficiencias[i]);
+        escritor.escreverCaractere(' ');
+        escritor.escreverInteiro(num_paradas[i]);
+        for (int64_t p = inicio_paradas[i]; p < inicio_paradas[i + 1]; p++) {
+            escritor.escreverCaractere(' ');
+            escritor.escreverDecimal2(coordenadas[2 * p]);
+            escritor.escreverCaractere(' ');
+            escritor.escreverDecimal2(coordenadas[2 * p + 1]);
+        }
+        escritor.escreverCaractere('\n');
+    }
+    return 0;
+}